@@ -7,6 +7,8 @@
 #ifndef FORWARDING_ADAPTER_TRAITS_H_
 #define FORWARDING_ADAPTER_TRAITS_H_
 
+#include <type_traits>
+
 namespace internal {
 
 /**
@@ -34,6 +36,31 @@ struct adapter_traits {
   using module_adapter_t = void;
 };
 
+/**
+ * Determine at compile time whether coupling the given adapter of a
+ * reconfiguration region requires waiting for its synced event. Every adapter
+ * of a reconfiguration region declares this by its static member
+ * "sync_required". Adapters that do not require synchronization are skipped
+ * when the synced events are collected during coupling.
+ *
+ * @tparam RrAdapter the type of the reconfiguration region's adapter, may be a
+ * reference type
+ */
+template <typename RrAdapter>
+constexpr bool adapter_sync_required_v = std::decay_t<RrAdapter>::sync_required;
+
+/**
+ * Determine at compile time whether coupling any of the given adapters of a
+ * reconfiguration region requires waiting for its synced event. If none does,
+ * coupling does not create an event list at all.
+ *
+ * @tparam RrAdapters the types of the reconfiguration region's adapters, may
+ * be reference types
+ */
+template <typename... RrAdapters>
+constexpr bool any_adapter_sync_required_v =
+    (adapter_sync_required_v<RrAdapters> || ...);
+
 // template<>
 // struct adapter_traits<tlm_utils::simple_initiator_socket<>> {
 //     // ...
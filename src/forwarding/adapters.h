@@ -9,6 +9,7 @@
 
 /// @brief file that includes all existing adapters
 
+#include "forwarding/nc_adapter_pool.h"
 #include "forwarding/port_adapter.h"
 #include "forwarding/tlm_adapter.h"
 #include "forwarding/vector_adapter.h"
@@ -0,0 +1,87 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+#ifndef FORWARDING_NC_ADAPTER_ARRAY_H_
+#define FORWARDING_NC_ADAPTER_ARRAY_H_
+
+#include <cstddef>
+#include <new>
+#include <systemc>
+#include <utility>
+
+#include "forwarding/nc_adapter_pool.h"
+
+namespace internal {
+
+/**
+ * Fixed-capacity array of adapters, which are stored contiguously in a single
+ * allocation from the adapter pool. In contrast to sc_vector, the elements do
+ * not need to be sc_objects and are neither allocated nor registered one by
+ * one, which keeps the per-element overhead of vector adapters low. The
+ * adapters are neither copyable nor movable, so the capacity has to be reserved
+ * once before any element is constructed.
+ *
+ * @tparam T the type of the adapters
+ */
+template <class T>
+class nc_adapter_array {
+  T *m_data = nullptr;
+  size_t m_size = 0;
+  size_t m_capacity = 0;
+
+ public:
+  nc_adapter_array() = default;
+
+  nc_adapter_array(const nc_adapter_array &) = delete;
+  nc_adapter_array &operator=(const nc_adapter_array &) = delete;
+
+  ~nc_adapter_array() {
+    // destroy in reverse order of construction
+    while (m_size > 0) {
+      m_data[--m_size].~T();
+    }
+  }
+
+  /**
+   * Allocate the storage for the given number of adapters. May only be called
+   * once.
+   *
+   * @param n the number of adapters
+   */
+  void reserve(size_t n) {
+    sc_assert(m_data == nullptr);
+    if (n == 0) return;
+
+    m_data = static_cast<T *>(
+        nc_adapter_pool::allocate(n * sizeof(T), alignof(T)));
+    m_capacity = n;
+  }
+
+  /**
+   * Construct a new adapter at the end of the array.
+   *
+   * @tparam Args the types of the constructor arguments
+   * @param args the constructor arguments
+   * @return reference to the constructed adapter
+   */
+  template <class... Args>
+  T &emplace_back(Args &&...args) {
+    sc_assert(m_size < m_capacity);
+
+    T *adapter = new (m_data + m_size) T(std::forward<Args>(args)...);
+    m_size++;
+    return *adapter;
+  }
+
+  T &operator[](size_t i) { return m_data[i]; }
+  const T &operator[](size_t i) const { return m_data[i]; }
+
+  size_t size() const { return m_size; }
+};
+
+}  // namespace internal
+
+#endif  // FORWARDING_NC_ADAPTER_ARRAY_H_
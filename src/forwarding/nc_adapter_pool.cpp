@@ -0,0 +1,32 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+#include "nc_adapter_pool.h"
+
+#include <algorithm>
+
+internal::nc_adapter_pool &internal::nc_adapter_pool::instance() {
+  static nc_adapter_pool pool;
+  return pool;
+}
+
+void *internal::nc_adapter_pool::allocate(size_t bytes, size_t alignment) {
+  nc_adapter_pool &pool = instance();
+  void *ptr = pool.m_next;
+  if (pool.m_next == nullptr ||
+      std::align(alignment, bytes, ptr, pool.m_left) == nullptr) {
+    // the remainder of the last block is abandoned
+    size_t size = std::max(block_size, bytes + alignment);
+    pool.m_blocks.emplace_back(new unsigned char[size]);
+    pool.m_bytes_held += size;
+    ptr = pool.m_blocks.back().get();
+    pool.m_left = size;
+    std::align(alignment, bytes, ptr, pool.m_left);
+  }
+  pool.m_next = static_cast<unsigned char *>(ptr) + bytes;
+  pool.m_left -= bytes;
+  return ptr;
+}
@@ -0,0 +1,96 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+#ifndef FORWARDING_NC_ADAPTER_POOL_H_
+#define FORWARDING_NC_ADAPTER_POOL_H_
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace internal {
+
+/**
+ * Process-wide pool from which the memory of all adapters is allocated, so
+ * that the adapters of all members, regions and modules are packed into a few
+ * large blocks instead of being allocated one by one. In contrast to the
+ * nc_arena of a module, the pool does not follow the configuration state of
+ * any module: it exists once per process, is never released and memory of
+ * destroyed adapters is not reused. Adapters are created during elaboration
+ * only, so the pool grows with the design but not during simulation.
+ */
+class nc_adapter_pool {
+ public:
+  /// @brief Minimum size of the blocks that are allocated by the pool.
+  static constexpr size_t block_size = 64 * 1024;
+
+  /**
+   * Allocate memory for an adapter from the pool.
+   *
+   * @param bytes the number of bytes to allocate
+   * @param alignment the alignment of the allocated memory
+   * @return pointer to the allocated memory
+   */
+  static void *allocate(size_t bytes, size_t alignment);
+
+  /// @brief Number of bytes currently held by the blocks of the pool.
+  static size_t bytes_held() { return instance().m_bytes_held; }
+
+ private:
+  nc_adapter_pool() = default;
+
+  /// @brief The single pool of the process.
+  static nc_adapter_pool &instance();
+
+  /// @brief blocks of the pool, the last one is used for allocation
+  std::vector<std::unique_ptr<unsigned char[]>> m_blocks;
+  /// @brief next free byte in the last block
+  unsigned char *m_next = nullptr;
+  /// @brief number of free bytes in the last block
+  size_t m_left = 0;
+  /// @brief number of bytes held by all blocks
+  size_t m_bytes_held = 0;
+};
+
+/**
+ * Owning handle of a single adapter that is allocated from the adapter pool.
+ * Regions and modules hold their adapters through such handles, so that the
+ * adapter is destroyed together with its owner, while its memory stays in the
+ * pool.
+ *
+ * @tparam Adapter the type of the adapter
+ */
+template <class Adapter>
+class nc_pooled_adapter {
+  /// @brief the adapter, which is placed in the adapter pool
+  Adapter *m_adapter;
+
+ public:
+  /**
+   * Construct the adapter in the pool with the given arguments.
+   *
+   * @param args the arguments that are forwarded to the adapter's constructor
+   */
+  template <typename... Args>
+  explicit nc_pooled_adapter(Args &&...args)
+      : m_adapter(new (nc_adapter_pool::allocate(sizeof(Adapter),
+                                                 alignof(Adapter)))
+                      Adapter(std::forward<Args>(args)...)) {}
+
+  nc_pooled_adapter(const nc_pooled_adapter &) = delete;
+  nc_pooled_adapter &operator=(const nc_pooled_adapter &) = delete;
+
+  ~nc_pooled_adapter() { m_adapter->~Adapter(); }
+
+  Adapter &operator*() const { return *m_adapter; }
+  Adapter *operator->() const { return m_adapter; }
+};
+
+}  // namespace internal
+
+#endif  // FORWARDING_NC_ADAPTER_POOL_H_
@@ -8,7 +8,6 @@
 #define FORWARDING_NC_DECOUPLED_VALUE_H_
 
 #include <systemc>
-#include <type_traits>
 
 namespace internal {
 
@@ -23,40 +22,20 @@ namespace internal {
 template <typename T>
 struct nc_decoupled_value {};
 
-// template<typename T, typename =
-// std::enable_if_t<std::is_arithmetic<T>::value>> class
-// nc_decoupled_value<sc_core::sc_out<T>> {
-//     T value = 0;
-// };
-
 /**
- * Specialize nc_decoupled_value<T> where T is sc_out<type>. "get_value()"
- * always returns 0.
+ * Specialize nc_decoupled_value<T> for sc_out<T> with any type T.
+ * "get_value()" returns the value-initialized type, which is 0 for arithmetic
+ * types, sc_int, sc_uint and sc_bv, and X for sc_logic and sc_lv. Other values
+ * can be given for a type by a full specialization, or for a single member by
+ * declaring it as nc_out with a decouple policy.
+ *
+ * @tparam T the template argument for sc_out<T>
+ * @see nc_out
  */
-#define NC_INTERNAL_DECOUPLE_VALUE_ARITHMETIC(type)  \
-  template <>                                        \
-  struct nc_decoupled_value<sc_core::sc_out<type>> { \
-    static type get_value() { return 0; }            \
-  }
-
-NC_INTERNAL_DECOUPLE_VALUE_ARITHMETIC(bool);
-NC_INTERNAL_DECOUPLE_VALUE_ARITHMETIC(char);
-NC_INTERNAL_DECOUPLE_VALUE_ARITHMETIC(char16_t);
-NC_INTERNAL_DECOUPLE_VALUE_ARITHMETIC(char32_t);
-NC_INTERNAL_DECOUPLE_VALUE_ARITHMETIC(wchar_t);
-NC_INTERNAL_DECOUPLE_VALUE_ARITHMETIC(short);
-NC_INTERNAL_DECOUPLE_VALUE_ARITHMETIC(unsigned short);
-NC_INTERNAL_DECOUPLE_VALUE_ARITHMETIC(int);
-NC_INTERNAL_DECOUPLE_VALUE_ARITHMETIC(unsigned int);
-NC_INTERNAL_DECOUPLE_VALUE_ARITHMETIC(long);
-NC_INTERNAL_DECOUPLE_VALUE_ARITHMETIC(unsigned long);
-NC_INTERNAL_DECOUPLE_VALUE_ARITHMETIC(long long);
-NC_INTERNAL_DECOUPLE_VALUE_ARITHMETIC(unsigned long long);
-NC_INTERNAL_DECOUPLE_VALUE_ARITHMETIC(float);
-NC_INTERNAL_DECOUPLE_VALUE_ARITHMETIC(double);
-NC_INTERNAL_DECOUPLE_VALUE_ARITHMETIC(long double);
-
-#undef NC_INTERNAL_DECOUPLE_VALUE_ARITHMETIC
+template <typename T>
+struct nc_decoupled_value<sc_core::sc_out<T>> {
+  static T get_value() { return T(); }
+};
 
 }  // namespace internal
 
@@ -0,0 +1,113 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+#ifndef FORWARDING_NC_OUT_H_
+#define FORWARDING_NC_OUT_H_
+
+#include <systemc>
+
+#include "forwarding/nc_decoupled_value.h"
+
+/**
+ * Decouple policy that exposes the default decouple-value of the type, which
+ * is the value-initialized type unless internal::nc_decoupled_value is
+ * specialized for it. This is the policy of every plain sc_out member.
+ *
+ * A decouple policy provides a static function "get_value(T &value)", which
+ * sets the value that a decoupled sc_out<T> shall expose and returns true, or
+ * returns false if the sc_out shall keep its current value instead.
+ *
+ * @see nc_out
+ */
+struct nc_decouple_default {
+  template <typename T>
+  static bool get_value(T &value) {
+    value = internal::nc_decoupled_value<sc_core::sc_out<T>>::get_value();
+    return true;
+  }
+};
+
+/**
+ * Decouple policy that exposes a constant, which is converted to the type of
+ * the port.
+ *
+ * @tparam Value the constant, e.g. an integer or an enumerator
+ */
+template <auto Value>
+struct nc_decouple_constant {
+  template <typename T>
+  static bool get_value(T &value) {
+    value = T(Value);
+    return true;
+  }
+};
+
+/**
+ * Decouple policy that keeps the last value written by the decoupled module.
+ * Nothing is written on decoupling, so no value changed event is triggered at
+ * the static side during reconfiguration.
+ */
+struct nc_decouple_hold_last {
+  template <typename T>
+  static bool get_value(T &) {
+    return false;
+  }
+};
+
+/**
+ * Decouple policy that exposes high impedance, for ports of type sc_logic or
+ * sc_lv<W>, e.g. to drive resolved signals from the static side meanwhile.
+ */
+struct nc_decouple_high_z {
+  template <typename T>
+  static bool get_value(T &value) {
+    value = T(sc_dt::SC_LOGIC_Z);
+    return true;
+  }
+};
+
+/**
+ * Decouple policy that exposes the value returned by a user-defined provider.
+ *
+ * @tparam Provider a type with a static function "get_value()", which returns
+ * the value to expose
+ */
+template <class Provider>
+struct nc_decouple_with {
+  template <typename T>
+  static bool get_value(T &value) {
+    value = Provider::get_value();
+    return true;
+  }
+};
+
+/**
+ * An sc_out member of an interface with a decouple policy, which determines
+ * the value that the region exposes at the static side while no module is
+ * coupled, e.g. during reconfiguration. The module's port is not affected.
+ * Regions and modules of an interface registered via NC_INTERFACE_REGISTER
+ * expose a plain sc_out<T> in its place, with NC_INTERFACE_MEMBERS they
+ * inherit the nc_out itself.
+ *
+ * Example:
+ * nc_out<sc_dt::sc_lv<8>, nc_decouple_high_z> bus;
+ * nc_out<int, nc_decouple_hold_last> level;
+ *
+ * @tparam T the type of the port's value
+ * @tparam Policy the decouple policy
+ * @see nc_decouple_default, nc_decouple_constant, nc_decouple_hold_last,
+ * nc_decouple_high_z, nc_decouple_with
+ */
+template <typename T, class Policy = nc_decouple_default>
+class nc_out : public sc_core::sc_out<T> {
+ public:
+  typedef Policy policy_type;
+
+  using sc_core::sc_out<T>::sc_out;
+  using sc_core::sc_out<T>::operator=;
+};
+
+#endif  // FORWARDING_NC_OUT_H_
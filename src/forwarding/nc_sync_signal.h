@@ -0,0 +1,81 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+#ifndef FORWARDING_NC_SYNC_SIGNAL_H_
+#define FORWARDING_NC_SYNC_SIGNAL_H_
+
+#include <systemc>
+
+namespace internal {
+
+/**
+ * Signal whose readers can additionally see a preset value before the next
+ * update phase. Adapters use it to hand the current value of a port to a newly
+ * coupled module, so that coupling does not need to wait for any delta-cycle
+ * and can also be performed before the simulation starts.
+ *
+ * @tparam T the type of the signal's value
+ * @tparam POL the writer policy of the signal
+ */
+template <typename T,
+          sc_core::sc_writer_policy POL = sc_core::SC_UNCHECKED_WRITERS>
+class nc_sync_signal : public sc_core::sc_signal<T, POL> {
+  typedef sc_core::sc_signal<T, POL> base_type;
+
+ public:
+  nc_sync_signal() : base_type(sc_core::sc_gen_unique_name("nc_sync_signal")) {}
+
+  explicit nc_sync_signal(const char *nm) : base_type(nm) {}
+
+  /**
+   * Set the value of the signal, which readers see right away instead of only
+   * after the next update phase. The value is written through the regular
+   * write path as well, so the update phase triggers the value changed event
+   * and sets the change stamp like for any other write.
+   *
+   * @param value the new value
+   */
+  void preset(const T &value) {
+    m_preset_value = value;
+    m_preset = true;
+    this->write(value);
+  }
+
+  /**
+   * Read the current value, which is the preset one until the next update.
+   *
+   * @return the current value
+   */
+  const T &read() const override {
+    return m_preset ? m_preset_value : base_type::read();
+  }
+
+  /**
+   * Get a reference to the current value, like read.
+   *
+   * @return the current value
+   */
+  const T &get_data_ref() const override { return read(); }
+
+ protected:
+  /**
+   * Take over the written value, which ends the preset.
+   */
+  void update() override {
+    m_preset = false;
+    base_type::update();
+  }
+
+ private:
+  /// @brief the value that readers see until the next update
+  T m_preset_value{};
+  /// @brief flag indicating whether a preset value is pending
+  bool m_preset = false;
+};
+
+}  // namespace internal
+
+#endif  // FORWARDING_NC_SYNC_SIGNAL_H_
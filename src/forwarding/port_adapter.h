@@ -8,9 +8,11 @@
 #define FORWARDING_PORT_ADAPTER_H_
 
 #include <sysc/kernel/sc_module.h>
+#include <sysc/kernel/sc_spawn.h>
 
 #include "forwarding/adapter_traits.h"
-#include "forwarding/nc_decoupled_value.h"
+#include "forwarding/nc_out.h"
+#include "forwarding/nc_sync_signal.h"
 #include "nc_report.h"
 #include "region/abstract_reconf_region_base.h"
 
@@ -33,6 +35,29 @@ class rr_port_adapter {};
 template <class Port>
 class module_port_adapter {};
 
+/**
+ * Spawn a method process for an adapter. The method is statically sensitive to
+ * the given event or event finder and is not initialized. Adapters spawn
+ * their methods when they are statically bound before the end of elaboration,
+ * so the process belongs to the sc_module whose callback binds them.
+ *
+ * @tparam Func the type of the callable executed by the method
+ * @tparam Sensitivity the type of the sensitivity, an event or event finder
+ * @param func the callable executed by the method
+ * @param name the base name of the method
+ * @param sensitivity the static sensitivity of the method
+ */
+template <typename Func, typename Sensitivity>
+void nc_spawn_adapter_method(Func &&func, const char *name,
+                             Sensitivity *sensitivity) {
+  sc_core::sc_spawn_options opts;
+  opts.spawn_method();
+  opts.dont_initialize();
+  opts.set_sensitivity(sensitivity);
+  sc_core::sc_spawn(std::forward<Func>(func), sc_core::sc_gen_unique_name(name),
+                    &opts);
+}
+
 ///
 /// adapter traits specialization
 ///
@@ -60,15 +85,29 @@ struct adapter_traits<sc_core::sc_in<Primitive>> {
 /**
  * Specialization for sc_out<T> with generic type T.
  * Exposed type is always the sc_out<T>.
- * Adapters are rr_port_adapter<sc_out<T>> and module_port_adapter<sc_out<T>>
- * for reconfiguration region and module respectively.
+ * Adapters are the ones of nc_out<T> with the default decouple policy.
  *
  * @tparam Primitive the template argument T for sc_out<T>
- * @see rr_port_adapter, module_port_adapter
+ * @see rr_port_adapter, module_port_adapter, nc_decouple_default
  */
 template <typename Primitive>
-struct adapter_traits<sc_core::sc_out<Primitive>> {
-  typedef sc_core::sc_out<Primitive> data_type;
+struct adapter_traits<sc_core::sc_out<Primitive>>
+    : adapter_traits<nc_out<Primitive>> {};
+
+/**
+ * Specialization for nc_out<T, Policy> with generic type T.
+ * Exposed type is always the sc_out<T>, the policy only affects the adapters.
+ * Adapters are rr_port_adapter<nc_out<T, Policy>> and
+ * module_port_adapter<nc_out<T, Policy>> for reconfiguration region and
+ * module respectively.
+ *
+ * @tparam Primitive the template argument T for nc_out<T, Policy>
+ * @tparam Policy the decouple policy
+ * @see rr_port_adapter, module_port_adapter
+ */
+template <typename Primitive, class Policy>
+struct adapter_traits<nc_out<Primitive, Policy>> {
+  typedef nc_out<Primitive, Policy> data_type;
 
   typedef sc_core::sc_out<Primitive> rr_exposed_t;
   typedef sc_core::sc_out<Primitive> module_exposed_t;
@@ -82,72 +121,58 @@ struct adapter_traits<sc_core::sc_out<Primitive>> {
 ///
 
 /**
- * This adapter contains a driver (sc_out) and a signal used to connect the
- * driver to the sc_in exposed to the module. When this adapter was coupled with
- * a rr_port_adapter<sc_in<T>>, the other adapter can use this driver to
- * propagate any value changes of the sc_in exposed at the static side.
+ * This adapter contains the signal that the sc_in exposed to the module is
+ * bound to. When this adapter was coupled with a rr_port_adapter<sc_in<T>>,
+ * the other adapter writes any value changes of the sc_in exposed at the static
+ * side to this signal. The signal is the only sc_object of the adapter and is
+ * part of the module that contains the adapter.
  *
  * @tparam T the template argument for sc_in<T>
  * @see rr_port_adapter<sc_in<T>>
  */
 template <typename T>
-class module_port_adapter<sc_core::sc_in<T>> : public sc_core::sc_module {
+class module_port_adapter<sc_core::sc_in<T>> {
   typedef sc_core::sc_in<T> data_type;
 
   friend class rr_port_adapter<data_type>;
 
-  /// @brief Pointer to the adapter of the reconfiguration region this module is
-  /// configured at. May be nullptr.
-  rr_port_adapter<data_type> *m_rr_adapter = nullptr;
-
   /// @brief Reference to the sc_in port that is exposed by the module.
   data_type &m_exposed_port;
 
-  /// @brief The internal sc_out port used to drive the exposed sc_in.
-  sc_core::sc_out<T> m_driver;
-
-  /// @brief The signal used to connect the internal sc_out with the exposed
-  /// sc_in.
-  sc_core::sc_signal<T> m_signal;
+  /// @brief The signal that the exposed sc_in is bound to and that a coupled
+  /// adapter writes to. It can be preset when the adapter is coupled.
+  nc_sync_signal<T> m_signal;
 
+ public:
   /**
-   * Get the default name for a sc_in port adapter on the module side.
+   * Constructs an adapter given the adapted port that is exposed by the
+   * module.
    *
-   * @return the default name of ths module
+   * @param port the sc_in port that is exposed by the module
    */
-  static sc_core::sc_module_name default_name() {
-    return sc_core::sc_gen_unique_name("module_port_adapter_sc_in");
-  }
-
- public:
-  SC_HAS_PROCESS(module_port_adapter);
+  explicit module_port_adapter(data_type &port) : m_exposed_port(port) {}
 
   /**
-   * Constructs an adapter given the adapted port that is exposed by the module
-   * and optionally a name.
-   *
-   * @param port the sc_in port that is exposed by the module
-   * @param nm (optional) the name of the module
+   * Bind the sc_in exposed to the module to the internal signal, so that it
+   * can be driven by a coupled adapter.
    */
-  explicit module_port_adapter(data_type &port,
-                               sc_core::sc_module_name nm = default_name())
-      : sc_core::sc_module(nm), m_exposed_port(port) {
-    m_driver.bind(m_signal);
-    m_exposed_port.bind(m_signal);
-  }
+  void static_bind() { m_exposed_port.bind(m_signal); }
 };
 
 /**
- * This adapter has a thread that is sensitive to value changes of the sc_in
+ * This adapter has a method that is sensitive to value changes of the sc_in
  * exposed at the static side. When this adapter was coupled with a
- * module_port_adapter<sc_in<T>>, it can use the others adapter driver to
- * propagate any value changes of the sc_in exposed at the static side.
+ * module_port_adapter<sc_in<T>>, it writes any value changes of the sc_in
+ * exposed at the static side to the signal of the other adapter. The
+ * current value is handed to the other adapter immediately on coupling.
+ * The adapter is no sc_module itself, its method belongs to the
+ * reconfiguration region that contains the adapter.
  *
  * @tparam T the template argument for sc_in<T>
  * @see module_port_adapter<sc_in<T>>
  */
 template <typename T>
-class rr_port_adapter<sc_core::sc_in<T>> : public sc_core::sc_module {
+class rr_port_adapter<sc_core::sc_in<T>> {
   typedef sc_core::sc_in<T> data_type;
   typedef sc_core::sc_in<T> exposed_type;
 
@@ -161,65 +186,57 @@ class rr_port_adapter<sc_core::sc_in<T>> : public sc_core::sc_module {
   /// reconfiguration region.
   exposed_type &m_exposed_input;
 
-  /// @brief Event used to notify the update loop that an adapter of a new
-  /// module was coupled.
-  sc_core::sc_event m_bind_event;
-
-  /// @brief Flag indicating whether a synchronization is still in progress.
-  bool m_syncing = false;
-
-  /// @brief Event that is triggered when the adapter has completed
+  /// @brief Event that is never triggered, since this adapter does not require
   /// synchronization.
   sc_core::sc_event m_synced;
 
-  /**
-   * Get the default name for a sc_in port adapter on the reconfiguration
-   * region side.
-   *
-   * @return the default name of ths module
-   */
-  static sc_core::sc_module_name default_name() {
-    return sc_core::sc_gen_unique_name("rr_port_adapter_sc_in");
-  }
+  /// @brief Name used for reports, which is the one of the adapted port.
+  const char *name() const { return m_exposed_input.name(); }
 
  public:
-  SC_HAS_PROCESS(rr_port_adapter);
+  /// @brief The current value of the exposed sc_in is preset at the newly
+  /// coupled adapter within dynamic_bind, so there is nothing to wait for.
+  static constexpr bool sync_required = false;
 
   /**
    * Constructs an adapter given the reference to the reconfiguration region
-   * that contains it, the adapted port that is exposed by the reconfiguration
-   * region and optionally a name.
+   * that contains it and the adapted port that is exposed by the
+   * reconfiguration region.
    *
    * @param rr the reconfiguration region that contains the adapter
    * @param input the sc_in port that is exposed by the module
-   * @param nm (optional) the name of the module
    */
-  rr_port_adapter(abstract_reconf_region_base &rr, exposed_type &input,
-                  sc_core::sc_module_name nm = default_name())
-      : sc_core::sc_module(nm), m_exposed_input(input) {
-    SC_THREAD(update);
+  rr_port_adapter(abstract_reconf_region_base &rr, exposed_type &input)
+      : m_exposed_input(input) {}
+
+  /**
+   * Spawn the method that propagates value changes of the exposed sc_in to
+   * the coupled adapter.
+   */
+  void static_bind() {
+    nc_spawn_adapter_method([this] { update(); }, "rr_port_adapter_sc_in",
+                            &m_exposed_input.value_changed());
   }
 
   /**
-   * This thread writes a new value to the coupled module adapter whenever the
-   * value of the exposed sc_in changes or a new adapter is coupled and it
-   * should be synchronized.
+   * Bind the sc_in of the given module adapter directly to the sc_in exposed
+   * at the static side. Neither of the adapters is used afterwards.
+   *
+   * @param module_adapter the module adapter whose sc_in shall be bound
    */
-  [[noreturn]] void update() {
-    while (true) {
-      wait(m_exposed_input.value_changed_event() | m_bind_event);
-
-      if (m_module_adapter != nullptr) {
-        m_module_adapter->m_driver.write(m_exposed_input.read());
-        NC_REPORT_DEBUG_ADAPTER(name(),
-                                "updated to value " << m_exposed_input.read());
-
-        // notify end of sync
-        if (m_syncing) {
-          m_syncing = false;
-          m_synced.notify(sc_core::SC_ZERO_TIME);
-        }
-      }
+  void freeze(module_port_adapter<data_type> &module_adapter) {
+    module_adapter.m_exposed_port.bind(m_exposed_input);
+  }
+
+  /**
+   * This method writes a new value to the coupled module adapter whenever the
+   * value of the exposed sc_in changes.
+   */
+  void update() {
+    if (m_module_adapter != nullptr) {
+      m_module_adapter->m_signal.write(m_exposed_input.read());
+      NC_REPORT_DEBUG_ADAPTER(name(),
+                              "updated to value " << m_exposed_input.read());
     }
   }
 
@@ -227,8 +244,10 @@ class rr_port_adapter<sc_core::sc_in<T>> : public sc_core::sc_module {
    * Couple the given module adapter with this adapter.
    * This sets up the forwarding procedures.
    * If the passed sync flag is true, the current value of the exposed sc_in
-   * is read and written to the newly coupled adapter. When all is done, the
-   * synced event will be triggered.
+   * is read and preset at the signal of the newly coupled adapter, so that the
+   * module reads it right away. This neither blocks nor needs a delta-cycle and
+   * is thus also possible before the simulation starts. The value changed
+   * event of the signal is triggered in the next update phase as usual.
    *
    * @param module_adapter the module adapter that shall be coupled to this
    * adapter
@@ -240,13 +259,11 @@ class rr_port_adapter<sc_core::sc_in<T>> : public sc_core::sc_module {
     // make sure nothing is bound
     sc_assert(m_module_adapter == nullptr);
     m_module_adapter = &module_adapter;
-    module_adapter.m_rr_adapter = this;
 
     if (sync) {
-      // set the current value by triggering the updater process
-      m_syncing = true;
-      m_bind_event.notify();
-      NC_REPORT_DEBUG_ADAPTER(name(), "trigger update on bind");
+      module_adapter.m_signal.preset(m_exposed_input.read());
+      NC_REPORT_DEBUG_ADAPTER(name(),
+                              "preset value " << m_exposed_input.read());
     }
   }
 
@@ -261,11 +278,11 @@ class rr_port_adapter<sc_core::sc_in<T>> : public sc_core::sc_module {
     // make sure we unbind from the correct socket
     sc_assert(m_module_adapter == &module_adapter);
     m_module_adapter = nullptr;
-    module_adapter.m_rr_adapter = nullptr;
   }
 
   /**
-   * Retrieve the event that is triggered when synchronization completed.
+   * Retrieve the synced event, which only exists for the uniform interface of
+   * all adapters. It is never triggered, since sync_required is false.
    *
    * @return the synced event
    */
@@ -277,181 +294,167 @@ class rr_port_adapter<sc_core::sc_in<T>> : public sc_core::sc_module {
 ///
 
 /**
- * This adapter contains a listener (sc_in) and a signal used to connect the
- * listener to the sc_out exposed to the module. When this adapter was coupled
- * with a rr_port_adapter<sc_out<T>>, it will use its listener to notify the
- * other adapter whenever the module wrote a new value to the exposed sc_out.
+ * This adapter contains the signal that the sc_out exposed to the module is
+ * bound to. When this adapter was coupled with a
+ * rr_port_adapter<nc_out<T, Policy>>, the other adapter waits for value
+ * changes of this signal and forwards them to the static side. The signal is
+ * the only sc_object of the adapter and is part of the module that contains
+ * the adapter, which needs no process of its own for the forwarding.
  *
  * @tparam T the template argument for sc_out<T>
- * @see rr_port_adapter<sc_out<T>>
+ * @tparam Policy the decouple policy of the adapted member
+ * @see rr_port_adapter<nc_out<T, Policy>>
  */
-template <typename T>
-class module_port_adapter<sc_core::sc_out<T>> : public sc_core::sc_module {
+template <typename T, class Policy>
+class module_port_adapter<nc_out<T, Policy>> {
+  typedef nc_out<T, Policy> adapted_type;
   typedef sc_core::sc_out<T> data_type;
 
-  friend class rr_port_adapter<data_type>;
-
-  /// @brief Pointer to the adapter of the reconfiguration region this module is
-  /// configured at. May be nullptr.
-  rr_port_adapter<data_type> *m_rr_adapter = nullptr;
+  friend class rr_port_adapter<adapted_type>;
 
   /// @brief Reference to the sc_out port that is exposed by the module.
   data_type &m_exposed_port;
 
-  /// @brief The internal sc_in port used to listen to the exposed sc_out.
-  sc_core::sc_in<T> m_listener;
-
   /**
-   * @brief The signal used to connect the internal sc_in with the exposed
-   * sc_out. SC_MANY_WRITERS policy mandatory since processes respawn on
-   * reconfigure.
+   * @brief The signal that the exposed sc_out is bound to. SC_MANY_WRITERS
+   * policy mandatory since processes respawn on reconfigure.
    */
   sc_core::sc_signal<T, sc_core::SC_MANY_WRITERS> m_signal;
 
-  /**
-   * Get the default name for a sc_out port adapter on the module side.
-   *
-   * @return the default name of ths module
-   */
-  static sc_core::sc_module_name default_name() {
-    return sc_core::sc_gen_unique_name("module_port_adapter_sc_out");
-  }
-
  public:
-  SC_HAS_PROCESS(module_port_adapter);
-
   /**
-   * Constructs an adapter given the adapted port that is exposed by the module
-   * and optionally a name.
+   * Constructs an adapter given the adapted port that is exposed by the
+   * module.
    *
    * @param port the sc_out port that is exposed by the module
-   * @param nm (optional) the name of the module
    */
-  explicit module_port_adapter(data_type &port,
-                               sc_core::sc_module_name nm = default_name())
-      : sc_core::sc_module(nm), m_exposed_port(port) {
-    m_listener.bind(m_signal);
-    m_exposed_port.bind(m_signal);
-
-    SC_THREAD(update)
-  }
+  explicit module_port_adapter(data_type &port) : m_exposed_port(port) {}
 
   /**
-   * This thread notifies the currently coupled adapter that a new value needs
-   * to be fetched.
+   * Bind the sc_out exposed to the module to the signal of this adapter.
    */
-  [[noreturn]] void update() {
-    while (true) {
-      wait(m_listener.value_changed_event());
-
-      if (m_rr_adapter != nullptr) {
-        m_rr_adapter->m_update_output.notify();
-        NC_REPORT_DEBUG_ADAPTER(
-            name(), "triggered updated value to: " << m_listener.read());
-      }
-    }
-  }
+  void static_bind() { m_exposed_port.bind(m_signal); }
 };
 
 /**
- * This adapter has a driver thread that listens on an internal event, that
- * can be triggered by a coupled adapter of type module_port_adapter<sc_out<T>>.
- * Whenever the event gets triggered, the driver thread will read the value of
- * the other adapters listener and write it to the sc_out exposed at the
- * static side. Additionally, when the other adapter is decoupled again, the
- * driver thread will the decouple-value of the corresponding type to the
- * exposed sc_out.
+ * This adapter has a driver method that forwards the values written by the
+ * module. While an adapter of type module_port_adapter<nc_out<T, Policy>> is
+ * coupled, the method is dynamically sensitive to value changes of the
+ * signal of the other adapter and writes every new value to the sc_out
+ * exposed at the static side. Additionally, when the other adapter is
+ * decoupled again, the driver method will write the decouple-value given by
+ * the policy to the exposed sc_out, unless the policy keeps the last value.
+ * The adapter is no sc_module itself, its method belongs to the
+ * reconfiguration region that contains the adapter.
  *
  * @tparam T the template argument for sc_out<T>
- * @see module_port_adapter<sc_out<T>>
+ * @tparam Policy the decouple policy of the adapted member
+ * @see module_port_adapter<nc_out<T, Policy>>
  */
-template <typename T>
-class rr_port_adapter<sc_core::sc_out<T>> : public sc_core::sc_module {
-  typedef sc_core::sc_out<T> data_type;
+template <typename T, class Policy>
+class rr_port_adapter<nc_out<T, Policy>> {
+  typedef nc_out<T, Policy> adapted_type;
   typedef sc_core::sc_out<T> exposed_type;
-  typedef nc_decoupled_value<data_type> default_value_t;
 
-  friend class module_port_adapter<data_type>;
+  friend class module_port_adapter<adapted_type>;
 
   /// @brief Pointer to the corresponding adapter of the currently configured
   /// module. May be nullptr.
-  module_port_adapter<data_type> *m_module_adapter = nullptr;
+  module_port_adapter<adapted_type> *m_module_adapter = nullptr;
 
   /// @brief Reference to the sc_out port that is exposed by the
   /// reconfiguration region.
   exposed_type &m_exposed_output;
 
-  /// @brief Event used to notify the to notify the driver that a new value
-  /// needs to be written
+  /// @brief Event used to notify the driver that an adapter was coupled or
+  /// decoupled.
   sc_core::sc_event m_update_output;
 
   /// @brief Flag indicating whether the adapter is currently coupled with a
   /// module adapter.
   bool m_decoupled = false;
 
+  /// @brief Flag indicating that an adapter was just coupled, so the driver
+  /// only needs to wait for its signal.
+  bool m_coupled = false;
+
   /// @brief Event that is triggered when the adapter has completed
   /// synchronization.
   sc_core::sc_event m_synced;
 
-  /**
-   * Get the default name for a sc_out port adapter on the reconfiguration
-   * region side.
-   *
-   * @return the default name of ths module
-   */
-  static sc_core::sc_module_name default_name() {
-    return sc_core::sc_gen_unique_name("rr_port_adapter_sc_out");
-  }
+  /// @brief Name used for reports, which is the one of the adapted port.
+  const char *name() const { return m_exposed_output.name(); }
 
  public:
-  SC_HAS_PROCESS(rr_port_adapter);
+  /// @brief A newly configured module could not have written anything yet, so
+  /// there is nothing to synchronize.
+  static constexpr bool sync_required = false;
 
   /**
    * Constructs an adapter given the reference to the reconfiguration region
-   * that contains it, the adapted port that is exposed by the reconfiguration
-   * region and optionally a name.
+   * that contains it and the adapted port that is exposed by the
+   * reconfiguration region.
    *
    * @param rr the reconfiguration region that contains the adapter
    * @param output the sc_out port that is exposed by the module
-   * @param nm (optional) the name of the module
    */
-  rr_port_adapter(abstract_reconf_region_base &rr, exposed_type &output,
-                  sc_core::sc_module_name nm = default_name())
-      : sc_core::sc_module(nm), m_exposed_output(output) {
-    SC_THREAD(drive_signal)
-    sensitive << m_update_output;
+  rr_port_adapter(abstract_reconf_region_base &rr, exposed_type &output)
+      : m_exposed_output(output) {}
+
+  /**
+   * Spawn the method that drives the sc_out exposed at the static side.
+   */
+  void static_bind() {
+    nc_spawn_adapter_method([this] { drive_signal(); },
+                            "rr_port_adapter_sc_out", &m_update_output);
+  }
+
+  /**
+   * Bind the sc_out of the given module adapter directly to the sc_out exposed
+   * at the static side, so that the module drives it without any relay.
+   * Neither of the adapters is used afterwards.
+   *
+   * @param module_adapter the module adapter whose sc_out shall be bound
+   */
+  void freeze(module_port_adapter<adapted_type> &module_adapter) {
+    module_adapter.m_exposed_port.bind(m_exposed_output);
   }
 
   /**
-   * This thread fetches the value that was written by the module from the
-   * currently coupled adapter and writes it to the sc_out exposed on the
-   * static side, whenever the module writes a new value. Additionally, when the
-   * other adapter gets decoupled, this thread writes the decouple-value of
-   * the corresponding type to the sc_out.
+   * This method fetches the value that was written by the module from the
+   * signal of the currently coupled adapter and writes it to the sc_out
+   * exposed on the static side, whenever the module writes a new value.
+   * Additionally, when the other adapter gets decoupled, this method writes
+   * the decouple-value of the policy to the sc_out. While no adapter is
+   * coupled, the method only waits for the static update event.
    */
-  [[noreturn]] void drive_signal() {
-    while (true) {
-      wait();
-
-      if (m_decoupled) {
-        m_exposed_output.write(default_value_t::get_value());
-        continue;
-      }
-
-      // fail silently if there was a decouple in between notification and
-      // triggering
-      if (m_module_adapter != nullptr) {
-        m_exposed_output.write(m_module_adapter->m_listener.read());
-        NC_REPORT_DEBUG_ADAPTER(
-            name(),
-            "updated value to: " << m_module_adapter->m_listener.read());
-      }
+  void drive_signal() {
+    if (m_decoupled) {
+      T value;
+      if (Policy::get_value(value)) m_exposed_output.write(value);
+      return;
     }
+
+    // fail silently if there was a decouple in between notification and
+    // triggering
+    if (m_module_adapter == nullptr) return;
+
+    // right after coupling, only a value that the module wrote in the same
+    // delta-cycle is forwarded, older values belong to an earlier coupling
+    if (!m_coupled || m_module_adapter->m_signal.event()) {
+      m_exposed_output.write(m_module_adapter->m_signal.read());
+      NC_REPORT_DEBUG_ADAPTER(
+          name(), "updated value to: " << m_module_adapter->m_signal.read());
+    }
+    m_coupled = false;
+    sc_core::next_trigger(m_module_adapter->m_signal.value_changed_event() |
+                          m_update_output);
   }
 
   /**
    * Couple the given module adapter with this adapter.
-   * This sets up the forwarding procedures.
+   * This sets up the forwarding procedures and ends the decoupling, so that
+   * the module can update the exposed sc_out again.
    * The adapters for sc_out do not need to by synchronized, since the module
    * was just configured and could not have written anything yet. Thus, if the
    * passed sync flag is true, then the synced event will be triggered in the
@@ -462,45 +465,55 @@ class rr_port_adapter<sc_core::sc_out<T>> : public sc_core::sc_module {
    * @param sync if true, the synced event will be triggered in the next
    * delta-cycle
    */
-  void dynamic_bind(module_port_adapter<data_type> &module_adapter,
+  void dynamic_bind(module_port_adapter<adapted_type> &module_adapter,
                     bool sync = true) {
     // make sure nothing is bound
     sc_assert(m_module_adapter == nullptr);
     m_module_adapter = &module_adapter;
-    module_adapter.m_rr_adapter = this;
 
-    if (sync) {
-      // end decouple, allow update by module again
-      m_decoupled = false;
-      NC_REPORT_DEBUG_ADAPTER(name(), "decouple ended");
-      m_synced.notify(sc_core::SC_ZERO_TIME);
+    // end decouple, allow update by module again
+    m_decoupled = false;
+    NC_REPORT_DEBUG_ADAPTER(name(), "decouple ended");
+
+    // let the driver wait for the signal of the coupled adapter, right away
+    // once the simulation runs, so that no write of the module is missed
+    m_coupled = true;
+    if (sc_core::sc_is_running()) {
+      m_update_output.notify();
+    } else {
+      m_update_output.notify(sc_core::SC_ZERO_TIME);
     }
+
+    if (sync) m_synced.notify(sc_core::SC_ZERO_TIME);
   }
 
   /**
    * Decouple the given module adapter from this adapter.
    * This tears down the forwarding procedures.
    * Additionally, the according decoupled flag is set and the updated event
-   * triggered, so that the driver thread writes the decouple-value.
+   * triggered, so that the driver method writes the decouple-value. If the
+   * policy keeps the last value, neither port is written.
    *
    * @param module_adapter the module adapter that shall be decoupled from this
    * adapter
    * @see rr_port_adapter::m_decoupled, rr_port_adapter::m_update_output
    */
-  void dynamic_unbind(module_port_adapter<data_type> &module_adapter) {
+  void dynamic_unbind(module_port_adapter<adapted_type> &module_adapter) {
     // make sure we unbind from the correct socket
     sc_assert(m_module_adapter == &module_adapter);
 
     // set decouple value on both ports
     m_decoupled = true;
-    m_update_output.notify();
-    // we can write here since module adapter uses signal with multiple writer
-    // policy
-    m_module_adapter->m_exposed_port.write(default_value_t::get_value());
+    T value;
+    if (Policy::get_value(value)) {
+      m_update_output.notify();
+      // we can write here since module adapter uses signal with multiple
+      // writer policy
+      m_module_adapter->m_exposed_port.write(value);
+    }
     NC_REPORT_DEBUG_ADAPTER(name(), "decoupled");
 
     m_module_adapter = nullptr;
-    module_adapter.m_rr_adapter = nullptr;
   }
 
   /**
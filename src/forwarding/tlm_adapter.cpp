@@ -11,28 +11,35 @@
 /// tlm_initiator_socket adapter
 ///
 internal::rr_initiator_socket_adapter::rr_initiator_socket_adapter(
-    abstract_reconf_region_base &rr, tlm::tlm_initiator_socket<> &exposed_isock,
-    const sc_module_name &nm)
-    : m_rr(rr),
-      m_exposed_isock(exposed_isock),
-      sc_module(sc_module_name(sc_gen_unique_name(nm))) {
+    abstract_reconf_region_base &rr, tlm::tlm_initiator_socket<> &exposed_isock)
+    : m_rr(rr), m_exposed_isock(exposed_isock) {}
+
+void internal::rr_initiator_socket_adapter::static_bind() {
   // bind this interface to the exposed socket
   m_exposed_isock.bind(*this);
 }
 
+void internal::rr_initiator_socket_adapter::freeze(
+    module_initiator_socket_adapter &module_adapter) {
+  // the module's socket is bound like a socket of a child module
+  module_adapter.m_exposed_isock.bind(m_exposed_isock);
+}
+
 tlm::tlm_sync_enum internal::rr_initiator_socket_adapter::nb_transport_bw(
     tlm::tlm_base_protocol_types::tlm_payload_type &trans,
     tlm::tlm_base_protocol_types::tlm_phase_type &phase, sc_time &t) {
   reconf_lock lock(m_rr);
   sc_assert(m_module_adapter != nullptr);
-  return m_module_adapter->m_tsock->nb_transport_bw(trans, phase, t);
+  return m_module_adapter->m_exposed_isock.get_base_export()->nb_transport_bw(
+      trans, phase, t);
 }
 
 void internal::rr_initiator_socket_adapter::invalidate_direct_mem_ptr(
     sc_dt::uint64 start_range, sc_dt::uint64 end_range) {
   reconf_lock lock(m_rr);
   sc_assert(m_module_adapter != nullptr);
-  m_module_adapter->m_tsock->invalidate_direct_mem_ptr(start_range, end_range);
+  m_module_adapter->m_exposed_isock.get_base_export()
+      ->invalidate_direct_mem_ptr(start_range, end_range);
 }
 
 void internal::rr_initiator_socket_adapter::dynamic_bind(
@@ -58,14 +65,12 @@ void internal::rr_initiator_socket_adapter::dynamic_unbind(
 }
 
 internal::module_initiator_socket_adapter::module_initiator_socket_adapter(
-    tlm::tlm_initiator_socket<> &exposed_isock, const sc_module_name &nm)
-    : sc_module(sc_module_name(sc_gen_unique_name(nm))),
-      m_exposed_isock(exposed_isock) {
-  m_tsock.bind(*this);
-}
+    tlm::tlm_initiator_socket<> &exposed_isock)
+    : m_exposed_isock(exposed_isock) {}
 
-void internal::module_initiator_socket_adapter::before_end_of_elaboration() {
-  m_tsock.bind(m_exposed_isock);
+void internal::module_initiator_socket_adapter::static_bind() {
+  // bind the forward path of the exposed socket to this interface
+  m_exposed_isock.get_base_port().bind(*this);
 }
 
 tlm::tlm_sync_enum internal::module_initiator_socket_adapter::nb_transport_fw(
@@ -103,43 +108,80 @@ unsigned int internal::module_initiator_socket_adapter::transport_dbg(
 ///
 
 internal::rr_target_socket_adapter::rr_target_socket_adapter(
-    abstract_reconf_region_base &rr, tlm::tlm_target_socket<> &exposed_tsock,
-    const sc_module_name &nm)
-    : m_rr(rr),
-      m_exposed_tsock(exposed_tsock),
-      sc_module(sc_module_name(sc_gen_unique_name(nm))) {
+    abstract_reconf_region_base &rr, tlm::tlm_target_socket<> &exposed_tsock)
+    : m_rr(rr), m_exposed_tsock(exposed_tsock) {}
+
+void internal::rr_target_socket_adapter::static_bind() {
   // bind this interface to the exposed socket
-  exposed_tsock.bind(*this);
+  m_exposed_tsock.bind(*this);
+}
+
+void internal::rr_target_socket_adapter::freeze(
+    module_target_socket_adapter &module_adapter) {
+  // the module's socket is bound like a socket of a child module
+  m_exposed_tsock.bind(module_adapter.m_exposed_tsock);
 }
 
 tlm::tlm_sync_enum internal::rr_target_socket_adapter::nb_transport_fw(
     tlm::tlm_base_protocol_types::tlm_payload_type &trans,
     tlm::tlm_base_protocol_types::tlm_phase_type &phase, sc_time &t) {
+  // a non-blocking call cannot wait for the demanded module to be load
+  bool demanded = !m_rr.is_demand_configuration() ||
+                  m_rr.request_demand_configuration(trans);
+  if (!demanded || !module_available()) {
+    // a software model may stand in, since it completes without waiting
+    if (m_rr.is_software_fallback() && phase == tlm::BEGIN_REQ &&
+        m_rr.software_b_transport(trans, t)) {
+      return tlm::TLM_COMPLETED;
+    }
+    trans.set_response_status(tlm::TLM_GENERIC_ERROR_RESPONSE);
+    return tlm::TLM_COMPLETED;
+  }
   reconf_lock lock(m_rr);
-  sc_assert(m_module_adapter != nullptr);
-  return m_module_adapter->m_isock->nb_transport_fw(trans, phase, t);
+  return m_module_adapter->m_exposed_tsock.get_base_export()->nb_transport_fw(
+      trans, phase, t);
 }
 
 void internal::rr_target_socket_adapter::b_transport(
     tlm::tlm_base_protocol_types::tlm_payload_type &trans, sc_time &t) {
+  // may wait until the demanded module is load, the lock is taken afterwards
+  bool demanded =
+      !m_rr.is_demand_configuration() || m_rr.demand_configure(trans);
+  // while the module cannot serve the transaction, its software model may
+  if (m_rr.is_software_fallback() && !module_available() &&
+      m_rr.software_b_transport(trans, t)) {
+    return;
+  }
+  // the demanded module was not load, as its load was aborted
+  if (!demanded) {
+    trans.set_response_status(tlm::TLM_GENERIC_ERROR_RESPONSE);
+    return;
+  }
   reconf_lock lock(m_rr);
   sc_assert(m_module_adapter != nullptr);
-  m_module_adapter->m_isock->b_transport(trans, t);
+  m_module_adapter->m_exposed_tsock.get_base_export()->b_transport(trans, t);
 }
 
 bool internal::rr_target_socket_adapter::get_direct_mem_ptr(
     tlm::tlm_base_protocol_types::tlm_payload_type &trans,
     tlm::tlm_dmi &dmi_data) {
+  if (!module_available()) return false;
   reconf_lock lock(m_rr);
-  sc_assert(m_module_adapter != nullptr);
-  return m_module_adapter->m_isock->get_direct_mem_ptr(trans, dmi_data);
+  return m_module_adapter->m_exposed_tsock.get_base_export()
+      ->get_direct_mem_ptr(trans, dmi_data);
 }
 
 unsigned int internal::rr_target_socket_adapter::transport_dbg(
     tlm::tlm_base_protocol_types::tlm_payload_type &trans) {
+  unsigned int count;
+  if (m_rr.is_software_fallback() && !module_available() &&
+      m_rr.software_transport_dbg(trans, count)) {
+    return count;
+  }
+  if (!module_available()) return 0;
   reconf_lock lock(m_rr);
-  sc_assert(m_module_adapter != nullptr);
-  return m_module_adapter->m_isock->transport_dbg(trans);
+  return m_module_adapter->m_exposed_tsock.get_base_export()->transport_dbg(
+      trans);
 }
 
 void internal::rr_target_socket_adapter::dynamic_bind(
@@ -165,16 +207,12 @@ void internal::rr_target_socket_adapter::dynamic_unbind(
 }
 
 internal::module_target_socket_adapter::module_target_socket_adapter(
-    tlm::tlm_target_socket<> &exposed_tsock, const sc_module_name &nm)
-    : sc_core::sc_module(sc_module_name(sc_gen_unique_name(nm))),
-      m_exposed_tsock(exposed_tsock) {
-  // bind this interface to the internal initiator socket
-  m_isock.bind(*this);
-}
+    tlm::tlm_target_socket<> &exposed_tsock)
+    : m_exposed_tsock(exposed_tsock) {}
 
-void internal::module_target_socket_adapter::before_end_of_elaboration() {
-  // bind the internal initiator socket to the exposed target socket
-  m_isock.bind(m_exposed_tsock);
+void internal::module_target_socket_adapter::static_bind() {
+  // bind the backward path of the exposed socket to this interface
+  m_exposed_tsock.get_base_port().bind(*this);
 }
 
 tlm::tlm_sync_enum internal::module_target_socket_adapter::nb_transport_bw(
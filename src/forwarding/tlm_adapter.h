@@ -74,11 +74,11 @@ struct adapter_traits<tlm::tlm_target_socket<>> {
  * coupled with a module_initiator_socket_adapter, it can "listen" to
  * transactions relayed by the other adapter and then propagate them to the
  * static side. The forward path of the transactions works the same way.
+ * The adapter has no ports or processes of its own and is thus no sc_module.
  *
  * @see module_initiator_socket_adapter
  */
-class rr_initiator_socket_adapter : public tlm::tlm_bw_transport_if<>,
-                                    public sc_core::sc_module {
+class rr_initiator_socket_adapter : public tlm::tlm_bw_transport_if<> {
   friend class module_initiator_socket_adapter;
 
   /// @brief Reference to the reconfiguration region that this adapter is
@@ -98,19 +98,19 @@ class rr_initiator_socket_adapter : public tlm::tlm_bw_transport_if<>,
   sc_core::sc_event m_synced;
 
  public:
+  /// @brief TLM socket adapters cannot synchronize anything.
+  static constexpr bool sync_required = false;
+
   /**
    * Constructs an adapter given the reference to the reconfiguration region
-   * that contains it, the adapted socket that is exposed by the reconfiguration
-   * region and optionally a name.
+   * that contains it and the adapted socket that is exposed by the
+   * reconfiguration region.
    *
    * @param rr the reconfiguration region that contains the adapter
    * @param exposed_isock the TLM socket that is adapted
-   * @param nm (optional) the name of the module
    */
-  explicit rr_initiator_socket_adapter(
-      abstract_reconf_region_base &rr,
-      tlm::tlm_initiator_socket<> &exposed_isock,
-      const sc_core::sc_module_name &nm = "rr_initiator_socket_adapter");
+  rr_initiator_socket_adapter(abstract_reconf_region_base &rr,
+                              tlm::tlm_initiator_socket<> &exposed_isock);
 
   /**
    * Implementation of tlm_bw_transport_if<>.
@@ -155,6 +155,21 @@ class rr_initiator_socket_adapter : public tlm::tlm_bw_transport_if<>,
   void dynamic_bind(module_initiator_socket_adapter &module_adapter,
                     bool sync = true);
 
+  /**
+   * Bind this adapter as backward path interface to the initiator socket
+   * exposed at the static side.
+   */
+  void static_bind();
+
+  /**
+   * Bind the initiator socket of the given module adapter hierarchically to
+   * the initiator socket exposed at the static side. Neither of the adapters is
+   * used afterwards.
+   *
+   * @param module_adapter the module adapter whose socket shall be bound
+   */
+  void freeze(module_initiator_socket_adapter &module_adapter);
+
   /**
    * Decouple the given module adapter from this adapter.
    * This tears down the forwarding procedures.
@@ -173,25 +188,21 @@ class rr_initiator_socket_adapter : public tlm::tlm_bw_transport_if<>,
 };
 
 /**
- * This adapter contains a tlm target socket and provides the necessary
- * interface implementation (tlm_fw_transport_if) to be bound to it. This target
- * socket will in turn be bound to the tlm initiator socket that is exposed to a
- * module. When this adapter was coupled with a rr_initiator_socket_adapter, it
- * can "listen" to transactions started by the module and relay them to the
+ * This adapter provides the forward path interface implementation
+ * (tlm_fw_transport_if) that the tlm initiator socket exposed to a module is
+ * bound to. When this adapter was coupled with a rr_initiator_socket_adapter,
+ * it can "listen" to transactions started by the module and relay them to the
  * coupled adapter. The rr_initiator_socket_adapter will then propagate these
- * transactions to the static side. The forward path of the transactions works
- * the same way.
+ * transactions to the static side. The backward path of the transactions is
+ * relayed by the other adapter to the export of the exposed socket directly.
+ * The adapter has no sockets or processes of its own, so it does not add any
+ * sc_object to the module that contains it.
  *
  * @see rr_initiator_socket_adapter
  */
-class module_initiator_socket_adapter : public tlm::tlm_fw_transport_if<>,
-                                        public sc_core::sc_module {
+class module_initiator_socket_adapter : public tlm::tlm_fw_transport_if<> {
   friend class rr_initiator_socket_adapter;
 
-  /// @brief The internal target socket that is bound to the by the module
-  /// exposed initiator socket.
-  tlm::tlm_target_socket<> m_tsock;
-
   /// @brief Pointer to the adapter of the reconfiguration region this module is
   /// configured at. May be nullptr.
   rr_initiator_socket_adapter *m_rr_adapter = nullptr;
@@ -202,21 +213,20 @@ class module_initiator_socket_adapter : public tlm::tlm_fw_transport_if<>,
  public:
   /**
    * Constructs an adapter given the adapted socket that is exposed by the
-   * module and optionally a name.
+   * module.
    *
    * @param exposed_isock the TLM socket that is adapted
-   * @param nm (optional) the name of the module
    */
   explicit module_initiator_socket_adapter(
-      tlm::tlm_initiator_socket<> &exposed_isock,
-      const sc_core::sc_module_name &nm = "module_initiator_socket_adapter");
+      tlm::tlm_initiator_socket<> &exposed_isock);
 
   /**
-   * SystemC callback used to bind the internal target socket to the exposed
-   * initiator socket since this has to be done after the interface
-   * implementation (a module) was bound to the initiator socket.
+   * Bind the port of the exposed initiator socket to this adapter. This is
+   * done before the end of elaboration, after the module bound its own
+   * sockets to the exposed initiator socket. It is not done if the module is
+   * frozen.
    */
-  void before_end_of_elaboration() override;
+  void static_bind();
 
   /**
    * Implementation of tlm_fw_transport_if<>.
@@ -253,7 +263,8 @@ class module_initiator_socket_adapter : public tlm::tlm_fw_transport_if<>,
    * Forwards the interface function call to the corresponding adapter of the
    * reconfiguration region the module is configured at. A reconfiguration lock
    * is employed to ensure, that the module is not unloaded while the call is
-   * still in progress.
+   * still in progress. No DMI access is granted while no module can serve
+   * transactions, not even by a software model.
    *
    * @param trans a TLM transaction payload instance
    * @param dmi_data a TLM DMI instance
@@ -288,11 +299,11 @@ class module_initiator_socket_adapter : public tlm::tlm_fw_transport_if<>,
  * transactions started by static modules and relay them to the coupled adapter.
  * The module_target_socket_adapter will then propagate these transactions to
  * its module. The backward path of the transactions works the same way.
+ * The adapter has no ports or processes of its own and is thus no sc_module.
  *
  * @see module_target_socket_adapter
  */
-class rr_target_socket_adapter : public tlm::tlm_fw_transport_if<>,
-                                 public sc_core::sc_module {
+class rr_target_socket_adapter : public tlm::tlm_fw_transport_if<> {
   friend class module_target_socket_adapter;
 
   /// @brief Reference to the reconfiguration region that this adapter is
@@ -311,31 +322,47 @@ class rr_target_socket_adapter : public tlm::tlm_fw_transport_if<>,
   /// synchronization.
   sc_core::sc_event m_synced;
 
+  /**
+   * Check whether a module is coupled and transactions can be forwarded to it.
+   *
+   * @return true if the coupled module can serve transactions, false otherwise
+   */
+  bool module_available() const {
+    return m_module_adapter != nullptr && !m_rr.transactions_blocked();
+  }
+
  public:
+  /// @brief TLM socket adapters cannot synchronize anything.
+  static constexpr bool sync_required = false;
+
   /**
    * Constructs an adapter given the reference to the reconfiguration region
-   * that contains it, the adapted socket that is exposed by the reconfiguration
-   * region and optionally a name.
+   * that contains it and the adapted socket that is exposed by the
+   * reconfiguration region.
    *
    * @param rr the reconfiguration region that contains the adapter
-   * @param exposed_isock the TLM socket that is adapted
-   * @param nm (optional) the name of the module
+   * @param exposed_tsock the TLM socket that is adapted
    */
-  explicit rr_target_socket_adapter(
-      abstract_reconf_region_base &rr, tlm::tlm_target_socket<> &exposed_tsock,
-      const sc_core::sc_module_name &nm = "rr_target_socket_adapter");
+  rr_target_socket_adapter(abstract_reconf_region_base &rr,
+                           tlm::tlm_target_socket<> &exposed_tsock);
 
   /**
    * Implementation of tlm_fw_transport_if<>.
    * Forwards the interface function call to the corresponding adapter of the
    * reconfiguration region the module is configured at. A reconfiguration lock
    * is employed to ensure, that the module is not unloaded while the call is
-   * still in progress.
+   * still in progress. Since the call must not wait, a transaction that no
+   * module can serve right away is completed at once, either by a software
+   * model if there is one, or with a generic error response. If demand
+   * configuration is enabled at the reconfiguration region, the module
+   * demanded by such a transaction is configured in the background, so that
+   * the initiator can retry it.
    *
    * @param trans a TLM transaction payload instance
    * @param phase a TLM transaction phase instance
    * @param t a SystemC time
    * @return a TLM sync value
+   * @see abstract_reconf_region_base#request_demand_configuration
    */
   tlm::tlm_sync_enum nb_transport_fw(
       tlm::tlm_base_protocol_types::tlm_payload_type &trans,
@@ -347,10 +374,16 @@ class rr_target_socket_adapter : public tlm::tlm_fw_transport_if<>,
    * Forwards the interface function call to the corresponding adapter of the
    * reconfiguration region the module is configured at. A reconfiguration lock
    * is employed to ensure, that the module is not unloaded while the call is
-   * still in progress.
+   * still in progress. If demand configuration is enabled at the
+   * reconfiguration region, the module demanded by the transaction is
+   * configured first. If no module can serve the transaction, it is served by
+   * a software model if there is one. Otherwise, a transaction whose demanded
+   * module was not load, since its load was aborted, gets a generic error
+   * response.
    *
    * @param trans a TLM transaction payload instance
    * @param t a SystemC time
+   * @see abstract_reconf_region_base#demand_configure
    */
   void b_transport(tlm::tlm_base_protocol_types::tlm_payload_type &trans,
                    sc_core::sc_time &t) override;
@@ -374,7 +407,8 @@ class rr_target_socket_adapter : public tlm::tlm_fw_transport_if<>,
    * Forwards the interface function call to the corresponding adapter of the
    * reconfiguration region the module is configured at. A reconfiguration lock
    * is employed to ensure, that the module is not unloaded while the call is
-   * still in progress.
+   * still in progress. If no module can serve the transaction, it is served
+   * by a software model if there is one, and otherwise no data is transferred.
    *
    * @param trans a TLM transaction payload instance
    * @return arbitrary debug value
@@ -397,6 +431,21 @@ class rr_target_socket_adapter : public tlm::tlm_fw_transport_if<>,
   void dynamic_bind(module_target_socket_adapter &module_adapter,
                     bool sync = true);
 
+  /**
+   * Bind this adapter as forward path interface to the target socket exposed
+   * at the static side.
+   */
+  void static_bind();
+
+  /**
+   * Bind the target socket exposed at the static side hierarchically to the
+   * target socket of the given module adapter. Neither of the adapters is used
+   * afterwards.
+   *
+   * @param module_adapter the module adapter whose socket shall be bound
+   */
+  void freeze(module_target_socket_adapter &module_adapter);
+
   /**
    * Decouple the given module adapter from this adapter.
    * This tears down the forwarding procedures.
@@ -415,24 +464,20 @@ class rr_target_socket_adapter : public tlm::tlm_fw_transport_if<>,
 };
 
 /**
- * This adapter contains a tlm initiator socket and provides the necessary
- * interface implementation (tlm_bw_transport_if) to be bound to it. This
- * initiator socket will in turn be bound to the tlm target socket that is
- * exposed to a module. When this adapter was coupled with a
- * rr_target_socket_adapter, it can "listen" to transactions relayed by the
- * other adapter and then propagate them to the module. The backward path of the
- * transactions works the same way.
+ * This adapter provides the backward path interface implementation
+ * (tlm_bw_transport_if) that the port of the tlm target socket exposed to a
+ * module is bound to. When this adapter was coupled with a
+ * rr_target_socket_adapter, the other adapter relays transactions to the
+ * export of the exposed socket directly, while this adapter relays the
+ * backward path calls of the module to the static side.
+ * The adapter has no sockets or processes of its own, so it does not add any
+ * sc_object to the module that contains it.
  *
  * @see rr_target_socket_adapter
  */
-class module_target_socket_adapter : public tlm::tlm_bw_transport_if<>,
-                                     public sc_core::sc_module {
+class module_target_socket_adapter : public tlm::tlm_bw_transport_if<> {
   friend class rr_target_socket_adapter;
 
-  /// @brief The internal initiator socket that is bound to the by the module
-  /// exposed target socket.
-  tlm::tlm_initiator_socket<> m_isock;
-
   /// @brief Reference to the target socket that is exposed by the module.
   tlm::tlm_target_socket<> &m_exposed_tsock;
 
@@ -443,22 +488,19 @@ class module_target_socket_adapter : public tlm::tlm_bw_transport_if<>,
  public:
   /**
    * Constructs an adapter given the adapted socket that is exposed by the
-   * module and optionally a name.
+   * module.
    *
    * @param exposed_tsock the TLM socket that is adapted
-   * @param nm (optional) the name of the module
    */
-
   explicit module_target_socket_adapter(
-      tlm::tlm_target_socket<> &exposed_tsock,
-      const sc_core::sc_module_name &nm = "module_target_socket_adapter");
+      tlm::tlm_target_socket<> &exposed_tsock);
 
   /**
-   * SystemC callback used to bind the internal initiator socket to the exposed
-   * target socket since this has to be done after the interface implementation
-   * (a module) was bound to the target socket.
+   * Bind the port of the exposed target socket to this adapter. This is done
+   * before the end of elaboration, after the module bound its own sockets to
+   * the exposed target socket. It is not done if the module is frozen.
    */
-  void before_end_of_elaboration() override;
+  void static_bind();
 
   /**
    * Implementation of tlm_bw_transport_if<>.
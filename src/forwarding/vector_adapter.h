@@ -8,6 +8,7 @@
 #define FORWARDING_VECTOR_ADAPTER_H_
 
 #include "forwarding/adapter_traits.h"
+#include "forwarding/nc_adapter_array.h"
 #include "region/abstract_reconf_region_base.h"
 
 namespace internal {
@@ -34,31 +35,35 @@ struct adapter_traits<sc_core::sc_vector<Element>> {
 /// rr-side adapter
 ///
 
+/**
+ * This adapter contains an element adapter for every element of the sc_vector
+ * exposed at the static side. The element adapters are created on static
+ * binding, since the size of the vector may not be known before.
+ *
+ * @tparam Element the element type of the sc_vector
+ * @see module_vector_adapter
+ */
 template <class Element>
-class rr_vector_adapter : public sc_core::sc_module {
+class rr_vector_adapter {
   using rr_exposed_t = sc_core::sc_vector<Element>;
   using rr_element_adapter_t = typename adapter_traits<Element>::rr_adapter_t;
 
   abstract_reconf_region_base &m_rr;
   rr_exposed_t &m_exposed_vector;
 
-  sc_core::sc_vector<rr_element_adapter_t> m_adapter_vector;
+  nc_adapter_array<rr_element_adapter_t> m_adapter_vector;
   sc_core::sc_event_and_list all_synced;
 
   /**
-   * Get the default name for a sc_vector port adapter on the reconfiguration
-   * region side.
-   *
-   * @return the default name of ths module
+   * Create an element adapter for every element of the exposed vector.
    */
-  static sc_core::sc_module_name default_name() {
-    return sc_core::sc_gen_unique_name("module_vector_adapter");
-  }
-
- protected:
-  void before_end_of_elaboration() override;
+  void init_elements();
 
  public:
+  /// @brief The vector needs to be synchronized if its elements need to be.
+  static constexpr bool sync_required =
+      adapter_sync_required_v<rr_element_adapter_t>;
+
   /**
    * TODO
    * Constructs an adapter given the reference to the reconfiguration region
@@ -67,11 +72,22 @@ class rr_vector_adapter : public sc_core::sc_module {
    *
    * @param rr the reconfiguration region that contains the adapter
    * @param exposed_isock the TLM socket that is adapted
-   * @param nm (optional) the name of the module
    */
   rr_vector_adapter(abstract_reconf_region_base &rr,
-                    rr_exposed_t &exposed_vector,
-                    const sc_core::sc_module_name &nm = default_name());
+                    rr_exposed_t &exposed_vector);
+
+  /**
+   * Create the element adapters and bind them statically.
+   */
+  void static_bind();
+
+  /**
+   * Create the element adapters of both vector adapters and bind the elements
+   * of the module's vector directly to the elements of the exposed vector.
+   *
+   * @param module_adapter the module adapter whose elements shall be bound
+   */
+  void freeze(module_vector_adapter<Element> &module_adapter);
 
  public:
   /**
@@ -109,8 +125,16 @@ class rr_vector_adapter : public sc_core::sc_module {
   auto &synced() const;
 };
 
+/**
+ * This adapter contains an element adapter for every element of the sc_vector
+ * exposed to the module. The element adapters are created on static binding,
+ * since the size of the vector may not be known before.
+ *
+ * @tparam Element the element type of the sc_vector
+ * @see rr_vector_adapter
+ */
 template <class Element>
-class module_vector_adapter : public sc_core::sc_module {
+class module_vector_adapter {
   friend class rr_vector_adapter<Element>;
 
   using module_exposed_t = sc_core::sc_vector<Element>;
@@ -119,19 +143,12 @@ class module_vector_adapter : public sc_core::sc_module {
 
   module_exposed_t &m_exposed_vector;
 
-  sc_core::sc_vector<module_element_adapter_t> m_adapter_vector;
+  nc_adapter_array<module_element_adapter_t> m_adapter_vector;
 
   /**
-   * Get the default name for a sc_vector port adapter on the module side.
-   *
-   * @return the default name of ths module
+   * Create an element adapter for every element of the exposed vector.
    */
-  static sc_core::sc_module_name default_name() {
-    return sc_core::sc_gen_unique_name("module_vector_adapter");
-  }
-
- protected:
-  void before_end_of_elaboration() override;
+  void init_elements();
 
  public:
   /**
@@ -140,11 +157,13 @@ class module_vector_adapter : public sc_core::sc_module {
    * module and optionally a name.
    *
    * @param exposed_isock the TLM socket that is adapted
-   * @param nm (optional) the name of the module
    */
-  explicit module_vector_adapter(
-      module_exposed_t &exposed_vector,
-      const sc_core::sc_module_name &nm = default_name());
+  explicit module_vector_adapter(module_exposed_t &exposed_vector);
+
+  /**
+   * Create the element adapters and bind them statically.
+   */
+  void static_bind();
 };
 
 }  // namespace internal
@@ -9,17 +9,36 @@
 template <class Element>
 internal::rr_vector_adapter<Element>::rr_vector_adapter(
     abstract_reconf_region_base &rr,
-    sc_core::sc_vector<Element> &exposed_vector,
-    const sc_core::sc_module_name &nm)
+    sc_core::sc_vector<Element> &exposed_vector)
     : m_rr(rr), m_exposed_vector(exposed_vector) {}
 
 template <class Element>
-void internal::rr_vector_adapter<Element>::before_end_of_elaboration() {
+void internal::rr_vector_adapter<Element>::init_elements() {
   // initialize vector of adapters using the elements form exposed_vector
-  m_adapter_vector.init(
-      m_exposed_vector.size(), [&](const char *cname, size_t i) {
-        return new rr_element_adapter_t(m_rr, m_exposed_vector[i]);
-      });
+  m_adapter_vector.reserve(m_exposed_vector.size());
+  for (size_t i = 0; i < m_exposed_vector.size(); i++) {
+    m_adapter_vector.emplace_back(m_rr, m_exposed_vector[i]);
+  }
+}
+
+template <class Element>
+void internal::rr_vector_adapter<Element>::static_bind() {
+  init_elements();
+  for (size_t i = 0; i < m_adapter_vector.size(); i++) {
+    m_adapter_vector[i].static_bind();
+  }
+}
+
+template <class Element>
+void internal::rr_vector_adapter<Element>::freeze(
+    module_vector_adapter<Element> &module_adapter) {
+  init_elements();
+  module_adapter.init_elements();
+  sc_assert(m_adapter_vector.size() == module_adapter.m_adapter_vector.size());
+
+  for (size_t i = 0; i < m_adapter_vector.size(); i++) {
+    m_adapter_vector[i].freeze(module_adapter.m_adapter_vector[i]);
+  }
 }
 
 template <class Element>
@@ -29,9 +48,13 @@ void internal::rr_vector_adapter<Element>::dynamic_bind(
   // vector
   sc_assert(m_adapter_vector.size() == module_adapter.m_adapter_vector.size());
 
-  // set up combined synced event first
-  for (int i = 0; i < m_adapter_vector.size(); i++) {
-    all_synced &= m_adapter_vector[i].synced();
+  // set up combined synced event first, but only if it will be waited for
+  if constexpr (sync_required) {
+    if (sync) {
+      for (int i = 0; i < m_adapter_vector.size(); i++) {
+        all_synced &= m_adapter_vector[i].synced();
+      }
+    }
   }
 
   for (int i = 0; i < m_adapter_vector.size(); i++) {
@@ -61,15 +84,22 @@ auto &internal::rr_vector_adapter<Element>::synced() const {
 
 template <class Element>
 internal::module_vector_adapter<Element>::module_vector_adapter(
-    module_vector_adapter::module_exposed_t &exposed_vector,
-    const sc_core::sc_module_name &nm)
+    module_vector_adapter::module_exposed_t &exposed_vector)
     : m_exposed_vector(exposed_vector) {}
 
 template <class Element>
-void internal::module_vector_adapter<Element>::before_end_of_elaboration() {
+void internal::module_vector_adapter<Element>::init_elements() {
   // initialize vector of adapters using the elements form exposed_vector
-  m_adapter_vector.init(
-      m_exposed_vector.size(), [this](const char *cname, size_t i) {
-        return new module_element_adapter_t(m_exposed_vector[i]);
-      });
-}
\ No newline at end of file
+  m_adapter_vector.reserve(m_exposed_vector.size());
+  for (size_t i = 0; i < m_exposed_vector.size(); i++) {
+    m_adapter_vector.emplace_back(m_exposed_vector[i]);
+  }
+}
+
+template <class Element>
+void internal::module_vector_adapter<Element>::static_bind() {
+  init_elements();
+  for (size_t i = 0; i < m_adapter_vector.size(); i++) {
+    m_adapter_vector[i].static_bind();
+  }
+}
@@ -7,8 +7,10 @@
 #include <sysc/kernel/sc_spawn.h>
 
 #include <sstream>
+#include <utility>
 
 #include "abstract_module_base.h"
+#include "modules/nc_bitstream_registry.h"
 #include "nc_report.h"
 
 void abstract_module_base::register_nested_rr(
@@ -26,7 +28,11 @@ void abstract_module_base::register_nested_rr(
 }
 
 void abstract_module_base::nc_activate() {
+  m_nc_reconf_imminent = false;
+  m_nc_arena.materialize(get_arena_size_bytes());
+
   this->on_activate();
+  m_nc_handoff_in.reset();
 
   for (auto& args : m_nc_proc_spawn_args) {
     m_nc_proc_handles.push_back(
@@ -41,6 +47,7 @@ void abstract_module_base::nc_activate() {
 void abstract_module_base::nc_deactivate()
 
 {
+  m_nc_handoff_out.reset();
   this->on_deactivate();
 
   for (auto& p : m_nc_proc_handles) {
@@ -49,13 +56,81 @@ void abstract_module_base::nc_deactivate()
   m_nc_proc_handles.clear();
 
   for (auto& region : m_nested_regions) {
-    region->unload_module();
+    region->do_nested_unload();
+  }
+
+  // processes are gone, so nothing can refer to the arena's memory anymore
+  m_nc_arena.release();
+}
+
+size_t abstract_module_base::get_bitstream_size_bytes() const {
+  const nc_bitstream_info *info =
+      nc_bitstream_registry::global().find(typeid(*this));
+  return info != nullptr ? info->size_bytes : 1024;
+}
+
+void abstract_module_base::nc_save_context() {
+  m_nc_context.clear();
+  this->on_save_context(m_nc_context);
+  m_nc_context_saved = true;
+}
+
+void abstract_module_base::nc_restore_context() {
+  if (!m_nc_context_saved) return;
+
+  this->on_restore_context(m_nc_context);
+  m_nc_context_saved = false;
+}
+
+void abstract_module_base::nc_discard_context() {
+  m_nc_context.clear();
+  m_nc_context_saved = false;
+}
+
+bool abstract_module_base::nc_notify_reconf_imminent() {
+  m_nc_reconf_imminent = true;
+  m_nc_reconf_acked = this->on_reconf_imminent();
+  return m_nc_reconf_acked;
+}
+
+bool abstract_module_base::nc_wait_reconf_ack(
+    const sc_core::sc_time& timeout) {
+  if (timeout == sc_core::SC_ZERO_TIME) {
+    while (!m_nc_reconf_acked) sc_core::wait(m_nc_reconf_ack);
+    return true;
+  }
+
+  sc_core::sc_time end = sc_core::sc_time_stamp() + timeout;
+  while (!m_nc_reconf_acked && sc_core::sc_time_stamp() < end) {
+    sc_core::wait(end - sc_core::sc_time_stamp(), m_nc_reconf_ack);
+  }
+  return m_nc_reconf_acked;
+}
+
+void abstract_module_base::nc_quiesce_nested_regions() {
+  for (auto& region : m_nested_regions) {
+    region->do_nested_quiesce();
   }
 }
 
+void abstract_module_base::acknowledge_reconf() {
+  if (!m_nc_reconf_imminent || m_nc_reconf_acked) return;
+  m_nc_reconf_acked = true;
+  m_nc_reconf_ack.notify(sc_core::SC_ZERO_TIME);
+}
+
+std::any abstract_module_base::nc_take_handoff_state(size_t& size_bytes) {
+  size_bytes = m_nc_handoff_out.has_value() ? m_nc_handoff_bytes : 0;
+  return std::exchange(m_nc_handoff_out, std::any());
+}
+
+void abstract_module_base::nc_give_handoff_state(std::any state) {
+  m_nc_handoff_in = std::move(state);
+}
+
 void abstract_module_base::nc_register_spawn_args(spawn_args&& args) {
   m_nc_proc_spawn_args.emplace_back(args);
 }
 
 abstract_module_base::abstract_module_base(const sc_core::sc_module_name& nm)
-    : sc_module(nm) {}
+    : sc_module(nm), m_nc_arena(name()) {}
@@ -9,6 +9,12 @@
 
 #include <sysc/kernel/sc_module.h>
 
+#include <any>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "modules/nc_arena.h"
 #include "processes/nc_sensitive_opts.h"
 #include "processes/spawn_args.h"
 #include "region/abstract_reconf_region_base.h"
@@ -48,19 +54,89 @@ class abstract_module_base : public sc_core::sc_module {
 
   /**
    * Activate this module.
-   * This will spawn all of the module's processes and perform the preload on
-   * every reconfiguration region that is registered as nested within this
-   * module.
+   * This will materialize the module's arena, spawn all of the module's
+   * processes and perform the preload on every reconfiguration region that is
+   * registered as nested within this module.
    */
   void nc_activate();
 
   /**
    * Deactivate this module.
-   * This will kill all of the module's processes and perform an unload on every
-   * reconfiguration region that is registered as nested within this module.
+   * This will kill all of the module's processes, perform an unload on every
+   * reconfiguration region that is registered as nested within this module and
+   * finally release the module's arena.
    */
   void nc_deactivate();
 
+  /**
+   * Save the context of this module by serializing it with on_save_context.
+   * This is done before the module is deactivated on preemption.
+   */
+  void nc_save_context();
+
+  /**
+   * Restore the previously saved context of this module with
+   * on_restore_context, if there is one. This is done after the module was
+   * activated again.
+   */
+  void nc_restore_context();
+
+  /**
+   * Discard the saved context of this module, if there is one, since the
+   * module was configured without restoring it and the context is outdated.
+   */
+  void nc_discard_context();
+
+  /**
+   * Tell this module that it is about to be unloaded by a reconfiguration,
+   * using on_reconf_imminent.
+   *
+   * @return true if the module is ready to be unloaded right away, false if it
+   * acknowledges later
+   */
+  bool nc_notify_reconf_imminent();
+
+  /**
+   * Wait until this module acknowledged the imminent reconfiguration. Must be
+   * called from a thread process.
+   *
+   * @param timeout the maximum time to wait, SC_ZERO_TIME to wait without
+   * limit
+   * @return false if the timeout expired before the acknowledgement
+   */
+  bool nc_wait_reconf_ack(const sc_core::sc_time &timeout);
+
+  /**
+   * Quiesce the modules configured at every reconfiguration region that is
+   * registered as nested within this module, since they are unloaded together
+   * with this module. Must be called from a thread process.
+   */
+  void nc_quiesce_nested_regions();
+
+  /**
+   * Take the state that this module handed off during its deactivation.
+   *
+   * @param size_bytes set to the size of the state in byte
+   * @return the state, which is empty if none was handed off
+   */
+  std::any nc_take_handoff_state(size_t &size_bytes);
+
+  /**
+   * Give this module the state handed off by the previously configured
+   * module, which it can take while it is activated.
+   *
+   * @param state the handed off state
+   */
+  void nc_give_handoff_state(std::any state);
+
+  /**
+   * Check whether a saved context of this module exists, which still needs to
+   * be restored.
+   *
+   * @return true if there is a saved context, false otherwise
+   */
+  bool nc_has_saved_context() const { return m_nc_context_saved; }
+
   /**
    * Decouple the modules adapters from those of the given reconfiguration
    * region.
@@ -70,9 +146,25 @@ class abstract_module_base : public sc_core::sc_module {
    */
   virtual void nc_decouple(abstract_reconf_region_base *rr) = 0;
 
+  /**
+   * Statically bind the modules adapters to its exposed members, so that they
+   * can be coupled with the adapters of a reconfiguration region later on.
+   */
+  virtual void nc_bind_adapters() = 0;
+
+  /**
+   * Bind the modules exposed members directly to those of the given
+   * reconfiguration region, bypassing the adapters on both sides. The module
+   * can never be decoupled from the region afterwards.
+   *
+   * @param rr the reconfiguration region to which the members shall be bound
+   */
+  virtual void nc_freeze(abstract_reconf_region_base *rr) = 0;
+
   /**
    * Hook that is called when a module gets activated, but before any processes
-   * are spawned.
+   * are spawned. The arena is already materialized at this point, so this is
+   * the place to allocate the module's buffers from it.
    */
   virtual void on_activate() {}
 
@@ -82,6 +174,77 @@ class abstract_module_base : public sc_core::sc_module {
    */
   virtual void on_deactivate() {}
 
+  /**
+   * Hook that is called when the module is preempted, before it gets
+   * deactivated. The module shall serialize its internal state, which would
+   * otherwise be lost, into the given buffer.
+   *
+   * @param context the buffer for the context, which is empty initially
+   */
+  virtual void on_save_context(std::vector<unsigned char> &context) {}
+
+  /**
+   * Hook that is called when a preempted module was activated again. The
+   * module shall restore its internal state from the given buffer.
+   *
+   * @param context the buffer filled by on_save_context
+   */
+  virtual void on_restore_context(const std::vector<unsigned char> &context) {}
+
+  /**
+   * Hook that is called when the module is about to be unloaded by a
+   * reconfiguration, while it is still active and coupled. A module that has
+   * work in flight returns false, finishes the work and then calls
+   * acknowledge_reconf, so that the reconfiguration waits for it.
+   *
+   * @return true if the module can be unloaded right away, false if it
+   * acknowledges later
+   */
+  virtual bool on_reconf_imminent() { return true; }
+
+  /**
+   * Acknowledge an imminent reconfiguration, after the module finished its
+   * work in flight. The reconfiguration continues right away. Does nothing if
+   * no reconfiguration is imminent.
+   */
+  void acknowledge_reconf();
+
+  /**
+   * Hand the given state off to the module that replaces this one at the
+   * reconfiguration region, e.g. registers that a variant with another
+   * implementation shall continue with. Only takes effect when called from
+   * on_deactivate. The transfer of the state adds the time to write the given
+   * number of bytes to the reconfiguration.
+   *
+   * @tparam T the type of the state
+   * @param state the state
+   * @param size_bytes the size of the state in byte
+   * @see abstract_module_base#take_handed_off_state
+   */
+  template <class T>
+  void hand_off_state(T state, size_t size_bytes = sizeof(T)) {
+    m_nc_handoff_out = std::move(state);
+    m_nc_handoff_bytes = size_bytes;
+  }
+
+  /**
+   * Take the state that the module replaced by this one handed off. The state
+   * is only available in on_activate.
+   *
+   * @tparam T the type of the state
+   * @return the state or std::nullopt if no state of the given type was
+   * handed off
+   */
+  template <class T>
+  std::optional<T> take_handed_off_state() {
+    T *state = std::any_cast<T>(&m_nc_handoff_in);
+    if (state == nullptr) return std::nullopt;
+
+    std::optional<T> result(std::move(*state));
+    m_nc_handoff_in.reset();
+    return result;
+  }
+
   /**
    * Register the spawn arguments of a process for this module.
    *
@@ -89,6 +252,14 @@ class abstract_module_base : public sc_core::sc_module {
    */
   void nc_register_spawn_args(spawn_args &&args);
 
+  /**
+   * Get the arena of this module. Memory can only be allocated from it while
+   * the module is active, everything allocated is released on deactivation.
+   *
+   * @return the module's arena
+   */
+  nc_arena &arena() { return m_nc_arena; }
+
  public:
   /**
    * Create an abstract module base given its name.
@@ -97,13 +268,83 @@ class abstract_module_base : public sc_core::sc_module {
    */
   explicit abstract_module_base(const sc_core::sc_module_name &nm);
 
+  /**
+   * Check whether the module was told that it is about to be unloaded by a
+   * reconfiguration, so that it shall not start any new work.
+   *
+   * @return true if a reconfiguration is imminent, false otherwise
+   */
+  bool is_reconf_imminent() const { return m_nc_reconf_imminent; }
+
   /**
    * Get the modules size in byte.
-   * Default value is 1024.
+   * Default value is the size of the bitstream that is bound to the module's
+   * type in the global bitstream registry, or 1024 if there is none.
    *
    * @return the modules size
+   * @see nc_bitstream_registry
+   */
+  virtual size_t get_bitstream_size_bytes() const;
+
+  /**
+   * Get the number of bytes that are reserved in the module's arena right when
+   * it is activated. Further memory is allocated on demand.
+   * Default value is 0.
+   *
+   * @return the initial arena size
    */
-  virtual size_t get_bitstream_size_bytes() const { return 1024; };
+  virtual size_t get_arena_size_bytes() const { return 0; }
+
+  /**
+   * Get the number of bytes currently held by the module's arena. This is 0
+   * while the module is not configured, unless the arena recycles its memory.
+   *
+   * @return the number of bytes held by the arena
+   */
+  size_t get_arena_bytes() const { return m_nc_arena.bytes_held(); }
+
+  /**
+   * Get the size of the module's context in byte, which needs to be
+   * transferred when the module is preempted and when it is restored.
+   * Default value is 0.
+   *
+   * @return the context size
+   */
+  virtual size_t get_context_size_bytes() const { return 0; }
+
+  /**
+   * Get the signatures of the module's configuration frames, one value per
+   * frame starting at the first frame of the region. A frame whose signature
+   * equals that of the frame currently in the region is not rewritten when the
+   * module is load, given that the region has a frame model. Modules that are
+   * derived from a shared base design declare equal signatures for the frames
+   * of the base.
+   * Default value is empty, which means that the whole bitstream is load.
+   *
+   * @return the frame signatures
+   * @see conf_manager#set_frame_model
+   */
+  virtual std::vector<size_t> get_frame_signatures() const { return {}; }
+
+  /**
+   * Get the size of the module's compressed bitstream in byte.
+   * Default value is 0, which means that the bitstream is not compressed.
+   *
+   * @return the compressed size
+   * @see abstract_module_base#get_compression_scheme
+   */
+  virtual size_t get_compressed_bitstream_size_bytes() const { return 0; }
+
+  /**
+   * Get the name of the scheme the bitstream is compressed with. A compressed
+   * bitstream is only transferred at regions whose decompressor supports the
+   * scheme, otherwise the uncompressed bitstream is transferred.
+   * Default value is empty.
+   *
+   * @return the compression scheme
+   * @see conf_manager#set_decompressor
+   */
+  virtual std::string get_compression_scheme() const { return ""; }
 
  private:
   /// @brief A vector of handles to currently running processes of the module.
@@ -117,6 +358,31 @@ class abstract_module_base : public sc_core::sc_module {
   /// as nested within this module.
   std::vector<abstract_reconf_region_base *> m_nested_regions;
 
+  /// @brief The arena whose memory is only held while the module is active.
+  nc_arena m_nc_arena;
+
+  /// @brief The context that was saved on the last preemption.
+  std::vector<unsigned char> m_nc_context;
+
+  /// @brief Flag indicating whether a saved context needs to be restored.
+  bool m_nc_context_saved = false;
+
+  /// @brief The state handed off by the module on its last deactivation,
+  /// until it is transferred.
+  std::any m_nc_handoff_out;
+  /// @brief The size of the state handed off by the module in byte.
+  size_t m_nc_handoff_bytes = 0;
+  /// @brief The state handed off to the module, only set during activation.
+  std::any m_nc_handoff_in;
+
+  /// @brief Flag indicating whether the module is about to be unloaded.
+  bool m_nc_reconf_imminent = false;
+  /// @brief Flag indicating whether the module acknowledged the imminent
+  /// reconfiguration.
+  bool m_nc_reconf_acked = false;
+  /// @brief Event that is triggered when the module acknowledged.
+  sc_core::sc_event m_nc_reconf_ack;
+
  protected:
 #ifndef NC_DONT_HIDE_MODULE_MEMBERS
 
@@ -0,0 +1,84 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+#include "nc_arena.h"
+
+#include <sysc/kernel/sc_module.h>
+
+#include <algorithm>
+
+nc_arena::nc_arena(std::string owner, size_t block_size)
+    : m_owner(std::move(owner)), m_block_size(block_size) {}
+
+nc_arena::~nc_arena() {
+  m_recycle = false;
+  release();
+}
+
+void nc_arena::materialize(size_t initial_bytes) {
+  sc_assert(!m_materialized && "Arena is already materialized.");
+  m_materialized = true;
+  m_bytes_used = 0;
+
+  if (initial_bytes > 0 &&
+      (m_blocks.empty() || m_blocks.front().size < initial_bytes)) {
+    m_blocks.clear();
+    m_bytes_held = 0;
+    add_block(initial_bytes);
+  }
+}
+
+void nc_arena::release() {
+  // destroy in reverse order of creation, later objects may refer to earlier
+  for (auto it = m_destructors.rbegin(); it != m_destructors.rend(); ++it) {
+    it->second(it->first);
+  }
+  m_destructors.clear();
+
+  if (m_recycle && !m_blocks.empty()) {
+    m_blocks.resize(1);
+    m_blocks.front().used = 0;
+    m_bytes_held = m_blocks.front().size;
+  } else {
+    m_blocks.clear();
+    m_bytes_held = 0;
+  }
+
+  m_bytes_used = 0;
+  m_materialized = false;
+}
+
+void *nc_arena::allocate(size_t bytes, size_t alignment) {
+  if (!m_materialized) {
+    SC_REPORT_ERROR(m_owner.c_str(),
+                    "Cannot allocate from the arena of an inactive module.");
+    return nullptr;
+  }
+
+  if (!m_blocks.empty()) {
+    auto &b = m_blocks.back();
+    void *p = b.data.get() + b.used;
+    size_t space = b.size - b.used;
+    if (std::align(alignment, bytes, p, space)) {
+      b.used = b.size - space + bytes;
+      m_bytes_used += bytes;
+      return p;
+    }
+  }
+
+  // the new block is large enough even for the worst case alignment offset
+  add_block(bytes + alignment);
+  return allocate(bytes, alignment);
+}
+
+void nc_arena::add_block(size_t size) {
+  size = std::max(size, m_block_size);
+  // not value-initialized, so that pages are only touched once they are used
+  m_blocks.push_back(
+      {std::unique_ptr<unsigned char[]>(new unsigned char[size]), size, 0});
+  m_bytes_held += size;
+  m_peak_bytes_held = std::max(m_peak_bytes_held, m_bytes_held);
+}
@@ -0,0 +1,187 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+#ifndef MODULES_NC_ARENA_H_
+#define MODULES_NC_ARENA_H_
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * Memory arena of a module whose lifetime follows the configuration state of
+ * the module. The arena is materialized when the module is activated and
+ * released when it is deactivated, so that buffers which are allocated from it
+ * (frame stores, FIFOs, tables, ...) only occupy memory while the module is
+ * configured.
+ * Memory is handed out from blocks in a bump pointer fashion and is only freed
+ * as a whole on release. Objects created with create() are destroyed on
+ * release in reverse order of their creation.
+ */
+class nc_arena {
+ public:
+  /// @brief Default size of the blocks that are allocated by the arena.
+  static constexpr size_t default_block_size = 64 * 1024;
+
+  /**
+   * Create an arena that is not materialized yet.
+   *
+   * @param owner name of the owning module, used for error reports
+   * @param block_size the minimum size of the blocks allocated by the arena
+   */
+  explicit nc_arena(std::string owner,
+                    size_t block_size = default_block_size);
+
+  nc_arena(const nc_arena &) = delete;
+  nc_arena &operator=(const nc_arena &) = delete;
+
+  ~nc_arena();
+
+  /**
+   * Materialize the arena so that memory can be allocated from it.
+   *
+   * @param initial_bytes number of bytes that are reserved right away, may be 0
+   */
+  void materialize(size_t initial_bytes = 0);
+
+  /**
+   * Destroy all objects that were created in the arena and free its blocks.
+   * If recycling is enabled, the first block is kept for the next
+   * materialization instead.
+   */
+  void release();
+
+  /**
+   * Allocate raw memory from the arena. The arena has to be materialized.
+   *
+   * @param bytes the number of bytes to allocate
+   * @param alignment the alignment of the allocated memory
+   * @return pointer to the allocated memory
+   */
+  void *allocate(size_t bytes, size_t alignment = alignof(std::max_align_t));
+
+  /**
+   * Construct an object of type T in the arena. It is destroyed when the arena
+   * is released.
+   *
+   * @tparam T the type of the object
+   * @tparam Args the types of the constructor arguments
+   * @param args the constructor arguments
+   * @return pointer to the constructed object
+   */
+  template <class T, class... Args>
+  T *create(Args &&...args) {
+    void *mem = allocate(sizeof(T), alignof(T));
+    T *obj = new (mem) T(std::forward<Args>(args)...);
+    if constexpr (!std::is_trivially_destructible<T>::value) {
+      m_destructors.emplace_back(obj,
+                                 [](void *p) { static_cast<T *>(p)->~T(); });
+    }
+    return obj;
+  }
+
+  /**
+   * Enable or disable recycling. If enabled, the arena keeps its first block on
+   * release, which saves the allocation on the next materialization at the
+   * cost of holding the memory while the module is not configured.
+   *
+   * @param recycle true to enable recycling
+   */
+  void set_recycle(bool recycle) { m_recycle = recycle; }
+
+  /// @brief Check whether the arena is currently materialized.
+  bool is_materialized() const { return m_materialized; }
+
+  /// @brief Number of bytes handed out since the last materialization.
+  size_t bytes_used() const { return m_bytes_used; }
+
+  /// @brief Number of bytes currently held by the arena's blocks.
+  size_t bytes_held() const { return m_bytes_held; }
+
+  /// @brief Maximum number of bytes that were held by the arena at once.
+  size_t peak_bytes_held() const { return m_peak_bytes_held; }
+
+ private:
+  /// @brief A contiguous chunk of memory from which allocations are served.
+  struct block {
+    std::unique_ptr<unsigned char[]> data;
+    size_t size;
+    size_t used;
+  };
+
+  /**
+   * Allocate a new block with at least the given size and make it the current
+   * block.
+   *
+   * @param size the minimum size of the block
+   */
+  void add_block(size_t size);
+
+  /// @brief name of the owning module
+  std::string m_owner;
+  /// @brief minimum size of a block
+  size_t m_block_size;
+
+  /// @brief blocks of the arena, the last one is used for allocation
+  std::vector<block> m_blocks;
+  /// @brief objects with non-trivial destructors and their destructor
+  std::vector<std::pair<void *, void (*)(void *)>> m_destructors;
+
+  bool m_materialized = false;
+  bool m_recycle = false;
+
+  size_t m_bytes_used = 0;
+  size_t m_bytes_held = 0;
+  size_t m_peak_bytes_held = 0;
+};
+
+/**
+ * Allocator that serves memory from a nc_arena, so that standard containers can
+ * be placed in it. Deallocation does nothing, the memory is reclaimed when the
+ * arena is released. Containers using this allocator should thus be created in
+ * the arena itself (see nc_arena::create), so that they are destroyed before
+ * the arena's memory is released.
+ *
+ * @tparam T the type of the allocated objects
+ */
+template <class T>
+class nc_arena_allocator {
+  template <class U>
+  friend class nc_arena_allocator;
+
+  nc_arena *m_arena;
+
+ public:
+  typedef T value_type;
+
+  explicit nc_arena_allocator(nc_arena &arena) : m_arena(&arena) {}
+
+  template <class U>
+  nc_arena_allocator(const nc_arena_allocator<U> &other)  // NOLINT
+      : m_arena(other.m_arena) {}
+
+  T *allocate(size_t n) {
+    return static_cast<T *>(m_arena->allocate(n * sizeof(T), alignof(T)));
+  }
+
+  void deallocate(T *, size_t) {}
+
+  template <class U>
+  bool operator==(const nc_arena_allocator<U> &other) const {
+    return m_arena == other.m_arena;
+  }
+
+  template <class U>
+  bool operator!=(const nc_arena_allocator<U> &other) const {
+    return m_arena != other.m_arena;
+  }
+};
+
+#endif  // MODULES_NC_ARENA_H_
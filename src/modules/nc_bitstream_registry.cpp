@@ -0,0 +1,283 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+#include "nc_bitstream_registry.h"
+
+#include <sysc/kernel/sc_module.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <fstream>
+#include <iterator>
+#include <thread>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+/// @brief Name used for reports of the registry.
+const char *const report_name = "nc_bitstream_registry";
+
+/// @brief Word that starts the configuration packets of a bitstream.
+constexpr uint32_t sync_word = 0xAA995566;
+/// @brief Address of the frame data input register.
+constexpr uint32_t fdri_register = 2;
+
+/**
+ * Read a big endian value from the given position.
+ *
+ * @param p pointer to the first byte
+ * @param bytes the number of bytes of the value
+ * @return the value
+ */
+uint32_t read_be(const unsigned char *p, size_t bytes) {
+  uint32_t value = 0;
+  for (size_t i = 0; i < bytes; i++) value = (value << 8) | p[i];
+  return value;
+}
+
+/**
+ * Find the configuration data in a .bit file, which follows a header of
+ * length-prefixed fields. The data is the content of the field 'e'.
+ *
+ * @param data the content of the file
+ * @param size the size of the file
+ * @param offset set to the offset of the configuration data
+ * @param length set to the length of the configuration data
+ * @return false if the file has no .bit header
+ */
+bool find_bit_data(const unsigned char *data, size_t size, size_t &offset,
+                   size_t &length) {
+  static const unsigned char magic[] = {0x00, 0x09, 0x0f, 0xf0, 0x0f, 0xf0,
+                                        0x0f, 0xf0, 0x0f, 0xf0, 0x00, 0x00,
+                                        0x01};
+  if (size < sizeof(magic) || !std::equal(magic, std::end(magic), data)) {
+    return false;
+  }
+
+  size_t pos = sizeof(magic);
+  while (pos < size) {
+    unsigned char key = data[pos++];
+    if (key == 'e') {
+      if (pos + 4 > size) return false;
+      length = read_be(data + pos, 4);
+      offset = pos + 4;
+      return offset + length <= size;
+    }
+    if (pos + 2 > size) return false;
+    pos += 2 + read_be(data + pos, 2);
+  }
+  return false;
+}
+
+/**
+ * Count the 32 bit words written to the FDRI register by the configuration
+ * packets that follow the sync word. Parsing stops at the first word that is
+ * no packet header.
+ *
+ * @param data the configuration data
+ * @param size the size of the configuration data
+ * @return the number of frame data words
+ */
+size_t count_frame_words(const unsigned char *data, size_t size) {
+  size_t pos = 0;
+  while (pos + 4 <= size && read_be(data + pos, 4) != sync_word) pos++;
+  pos += 4;
+
+  size_t frame_words = 0;
+  uint32_t last_register = 0;
+  while (pos + 4 <= size) {
+    uint32_t header = read_be(data + pos, 4);
+    pos += 4;
+
+    uint32_t type = header >> 29;
+    bool write = ((header >> 27) & 0x3) == 2;
+    size_t words;
+    if (type == 1) {
+      last_register = (header >> 13) & 0x3fff;
+      words = header & 0x7ff;
+    } else if (type == 2) {
+      words = header & 0x7ffffff;
+    } else {
+      break;
+    }
+
+    if (write && last_register == fdri_register) frame_words += words;
+    pos += 4 * words;
+  }
+  return frame_words;
+}
+
+/**
+ * Calculate the CRC-32 (IEEE 802.3) of the given data.
+ *
+ * @param data the data
+ * @param size the size of the data
+ * @return the checksum
+ */
+uint32_t crc32(const unsigned char *data, size_t size) {
+  static const std::array<uint32_t, 256> table = [] {
+    std::array<uint32_t, 256> t{};
+    for (uint32_t i = 0; i < 256; i++) {
+      uint32_t c = i;
+      for (int k = 0; k < 8; k++) {
+        c = (c & 1) ? 0xEDB88320 ^ (c >> 1) : c >> 1;
+      }
+      t[i] = c;
+    }
+    return t;
+  }();
+
+  uint32_t crc = 0xFFFFFFFF;
+  for (size_t i = 0; i < size; i++) {
+    crc = table[(crc ^ data[i]) & 0xff] ^ (crc >> 8);
+  }
+  return crc ^ 0xFFFFFFFF;
+}
+
+}  // namespace
+
+struct nc_bitstream_registry::mapped_file {
+  const unsigned char *data = nullptr;
+  size_t size = 0;
+#ifdef _WIN32
+  std::vector<unsigned char> buffer;
+#endif
+
+  /**
+   * Map the file at the given path.
+   *
+   * @param path the path of the file
+   * @return false if the file cannot be mapped
+   */
+  bool map(const std::string &path) {
+#ifdef _WIN32
+    std::ifstream in(path, std::ios::binary);
+    if (!in) return false;
+    buffer.assign(std::istreambuf_iterator<char>(in),
+                  std::istreambuf_iterator<char>());
+    data = buffer.data();
+    size = buffer.size();
+    return true;
+#else
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat st;
+    bool ok = fstat(fd, &st) == 0;
+    size = ok ? static_cast<size_t>(st.st_size) : 0;
+    if (ok && size > 0) {
+      void *p = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+      ok = p != MAP_FAILED;
+      data = ok ? static_cast<const unsigned char *>(p) : nullptr;
+    }
+    // the mapping stays valid without the descriptor
+    close(fd);
+    return ok;
+#endif
+  }
+
+  ~mapped_file() {
+#ifndef _WIN32
+    if (data != nullptr) munmap(const_cast<unsigned char *>(data), size);
+#endif
+  }
+};
+
+nc_bitstream_registry &nc_bitstream_registry::global() {
+  static nc_bitstream_registry registry;
+  return registry;
+}
+
+nc_bitstream_registry::~nc_bitstream_registry() = default;
+
+void nc_bitstream_registry::add(std::type_index module_type,
+                                const std::string &path) {
+  m_entries.push_back(std::make_unique<entry>(
+      entry{module_type, nc_bitstream_info{path}, nullptr, ""}));
+}
+
+void nc_bitstream_registry::parse(entry &e) const {
+  auto file = std::make_shared<mapped_file>();
+  if (!file->map(e.info.path)) {
+    e.error = "Cannot map bitstream file " + e.info.path;
+    return;
+  } else if (file->size == 0) {
+    e.error = "Empty bitstream file " + e.info.path;
+    return;
+  }
+
+  size_t offset = 0;
+  size_t length = file->size;
+  bool is_bit = find_bit_data(file->data, file->size, offset, length);
+  if (!is_bit && file->size >= 2 && read_be(file->data, 2) == 0x0009) {
+    e.error = "Malformed header in bitstream file " + e.info.path;
+    return;
+  } else if (length == 0) {
+    e.error = "No configuration data in bitstream file " + e.info.path;
+    return;
+  }
+
+  e.info.data = file->data + offset;
+  e.info.size_bytes = length;
+  e.info.frame_count =
+      count_frame_words(e.info.data, length) / m_frame_size_words;
+  if (m_checksums) e.info.checksum = crc32(e.info.data, length);
+  e.file = std::move(file);
+}
+
+void nc_bitstream_registry::load(size_t threads) {
+  size_t pending = m_entries.size() - m_loaded;
+  if (pending == 0) return;
+
+  if (threads == 0) {
+    threads = std::max(1u, std::thread::hardware_concurrency());
+  }
+  threads = std::min(threads, pending);
+
+  // every thread takes the next pending entry until none is left
+  std::atomic<size_t> next{m_loaded};
+  auto work = [this, &next] {
+    for (size_t i = next++; i < m_entries.size(); i = next++) {
+      parse(*m_entries[i]);
+    }
+  };
+  std::vector<std::thread> pool;
+  for (size_t i = 1; i < threads; i++) pool.emplace_back(work);
+  work();
+  for (auto &t : pool) t.join();
+
+  for (; m_loaded < m_entries.size(); m_loaded++) {
+    entry &e = *m_entries[m_loaded];
+    if (!e.error.empty()) {
+      SC_REPORT_ERROR(report_name, e.error.c_str());
+      continue;
+    }
+    if (!m_by_type.emplace(e.module_type, &e).second) {
+      SC_REPORT_ERROR(report_name,
+                      "Cannot bind several bitstreams to a module type.");
+    }
+  }
+}
+
+const nc_bitstream_info *nc_bitstream_registry::find(
+    std::type_index module_type) {
+  if (m_loaded < m_entries.size()) load();
+
+  auto it = m_by_type.find(module_type);
+  return it == m_by_type.end() ? nullptr : &it->second->info;
+}
+
+void nc_bitstream_registry::set_frame_size_words(size_t words) {
+  sc_assert(words > 0 && "Frame size has to be larger than zero.");
+  m_frame_size_words = words;
+}
@@ -0,0 +1,182 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+#ifndef MODULES_NC_BITSTREAM_REGISTRY_H_
+#define MODULES_NC_BITSTREAM_REGISTRY_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Metadata of a partial bitstream file.
+ */
+struct nc_bitstream_info {
+  /// @brief path of the bitstream file
+  std::string path;
+  /// @brief size of the configuration data in byte, without any file header
+  size_t size_bytes = 0;
+  /// @brief number of configuration frames written to the FDRI register,
+  /// including pad frames, or 0 if the data contains no frame writes
+  size_t frame_count = 0;
+  /// @brief CRC-32 of the configuration data, if checksums are enabled
+  std::optional<uint32_t> checksum;
+  /// @brief pointer to the mapped configuration data, valid as long as the
+  /// registry exists
+  const unsigned char *data = nullptr;
+};
+
+/**
+ * Registry that binds partial bitstream files to module types, so that the
+ * metadata of a module, like its bitstream size, comes from its actual
+ * bitstream instead of constants in the module's code.
+ * Files are added during elaboration and are memory-mapped and parsed when the
+ * registry is loaded, either explicitly or on the first lookup. Both Xilinx
+ * .bit files, whose header is skipped, and raw .bin files are supported, the
+ * format is detected from the content. The headers are parsed in parallel on
+ * a bounded number of host threads, and only the pages that the parser touches
+ * are read from disk, so that the startup stays short for hundreds of files.
+ * The data of the files stays mapped until the registry is destroyed.
+ *
+ * @see abstract_module_base#get_bitstream_size_bytes
+ */
+class nc_bitstream_registry {
+  /**
+   * A file that is mapped into memory, or read into it where memory mapping
+   * is not available.
+   */
+  struct mapped_file;
+
+  /**
+   * A file that was added to the registry.
+   */
+  struct entry {
+    std::type_index module_type;
+    nc_bitstream_info info;
+    std::shared_ptr<mapped_file> file;
+    /// @brief the error that occurred while loading, empty if none
+    std::string error;
+  };
+
+  /**
+   * Map and parse the file of the given entry. Called from the host threads,
+   * so errors are only recorded in the entry.
+   *
+   * @param e the entry
+   */
+  void parse(entry &e) const;
+
+ public:
+  /// @brief Default number of 32 bit words per frame, as of 7-series devices.
+  static constexpr size_t default_frame_size_words = 101;
+
+  /**
+   * Get the registry that is used by all modules.
+   *
+   * @return the global registry
+   */
+  static nc_bitstream_registry &global();
+
+  nc_bitstream_registry() = default;
+  nc_bitstream_registry(const nc_bitstream_registry &) = delete;
+  nc_bitstream_registry &operator=(const nc_bitstream_registry &) = delete;
+  ~nc_bitstream_registry();
+
+  /**
+   * Bind the bitstream file at the given path to a module type. The file is
+   * parsed on the next load.
+   *
+   * @tparam Module the type of the module
+   * @param path the path of the .bit or .bin file
+   */
+  template <class Module>
+  void add(const std::string &path) {
+    add(typeid(Module), path);
+  }
+
+  /**
+   * Bind the bitstream file at the given path to a module type. The file is
+   * parsed on the next load.
+   *
+   * @param module_type the type of the module
+   * @param path the path of the .bit or .bin file
+   */
+  void add(std::type_index module_type, const std::string &path);
+
+  /**
+   * Map and parse all files that were added since the last load.
+   *
+   * @param threads the maximum number of host threads to use, 0 to use one per
+   * hardware thread
+   */
+  void load(size_t threads = 0);
+
+  /**
+   * Get the metadata of the bitstream bound to a module type. Loads the
+   * registry first if files were added since the last load.
+   *
+   * @tparam Module the type of the module
+   * @return the metadata or nullptr if no bitstream is bound to the type
+   */
+  template <class Module>
+  const nc_bitstream_info *find() {
+    return find(typeid(Module));
+  }
+
+  /**
+   * Get the metadata of the bitstream bound to a module type. Loads the
+   * registry first if files were added since the last load.
+   *
+   * @param module_type the type of the module
+   * @return the metadata or nullptr if no bitstream is bound to the type
+   */
+  const nc_bitstream_info *find(std::type_index module_type);
+
+  /**
+   * Set the number of 32 bit words per configuration frame of the target
+   * device, which is used to count the frames. Applies to files parsed
+   * afterwards.
+   *
+   * @param words the frame size in words
+   */
+  void set_frame_size_words(size_t words);
+
+  /**
+   * Enable or disable the calculation of checksums for files parsed
+   * afterwards. Calculating a checksum reads the whole file.
+   *
+   * @param enable true to calculate checksums
+   */
+  void enable_checksums(bool enable = true) { m_checksums = enable; }
+
+  /**
+   * Get the number of files that were added to the registry.
+   *
+   * @return the number of files
+   */
+  size_t size() const { return m_entries.size(); }
+
+ private:
+  /// @brief all added files, the loaded ones first
+  std::vector<std::unique_ptr<entry>> m_entries;
+  /// @brief number of entries that were loaded already
+  size_t m_loaded = 0;
+  /// @brief the loaded entries, accessed by their module type
+  std::unordered_map<std::type_index, entry *> m_by_type;
+
+  /// @brief number of 32 bit words per configuration frame
+  size_t m_frame_size_words = default_frame_size_words;
+  /// @brief flag indicating whether checksums are calculated
+  bool m_checksums = false;
+};
+
+#endif  // MODULES_NC_BITSTREAM_REGISTRY_H_
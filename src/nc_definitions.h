@@ -124,12 +124,17 @@
 
 /// @brief Macro pair that defines the members and their according adapters for
 /// a reconfiguration region of the given interface.
-#define NC_INTERNAL_RR_MEMBER(iname, var)                           \
- public:                                                            \
-  internal::adapter_traits<decltype(iname::var)>::rr_exposed_t var; \
-                                                                    \
- private:                                                           \
-  internal::adapter_traits<decltype(iname::var)>::rr_adapter_t var##_adapter
+/// The adapters are allocated from the adapter pool and accessed by reference.
+#define NC_INTERNAL_RR_MEMBER(iname, var)                                 \
+ public:                                                                  \
+  internal::adapter_traits<decltype(iname::var)>::rr_exposed_t var;       \
+                                                                          \
+ private:                                                                 \
+  internal::nc_pooled_adapter<                                            \
+      internal::adapter_traits<decltype(iname::var)>::rr_adapter_t>       \
+      var##_adapter_storage;                                              \
+  internal::adapter_traits<decltype(iname::var)>::rr_adapter_t            \
+      &var##_adapter = *var##_adapter_storage
 #define NC_INTERNAL_RR_MEMBER_LIST(iname, ...) \
   NC_INTERNAL_FOREACH_1ARG(NC_INTERNAL_RR_MEMBER, iname, __VA_ARGS__)
 
@@ -147,41 +152,66 @@
 
 /// @brief Macro pair that initializes every given adapter with a reference to
 /// the this (reconfiguration region) and the adapted member.
-#define NC_INTERNAL_INIT_RR_MEMBER(var) var##_adapter(*this, var)
+#define NC_INTERNAL_INIT_RR_MEMBER(var) var##_adapter_storage(*this, var)
 #define NC_INTERNAL_INIT_RR_MEMBERS(...) \
   NC_INTERNAL_FOREACH_LIST(NC_INTERNAL_INIT_RR_MEMBER, __VA_ARGS__)
 
 /// @brief Macro pair that defines the members and their according adapters for
 /// module of the given interface.
-#define NC_INTERNAL_TASK_MEMBER(iname, var)                             \
- public:                                                                \
-  internal::adapter_traits<decltype(iname::var)>::module_exposed_t var; \
-                                                                        \
- private:                                                               \
-  internal::adapter_traits<decltype(iname::var)>::module_adapter_t var##_adapter
+/// The adapters are allocated from the adapter pool and accessed by reference.
+#define NC_INTERNAL_TASK_MEMBER(iname, var)                               \
+ public:                                                                  \
+  internal::adapter_traits<decltype(iname::var)>::module_exposed_t var;   \
+                                                                          \
+ private:                                                                 \
+  internal::nc_pooled_adapter<                                            \
+      internal::adapter_traits<decltype(iname::var)>::module_adapter_t>   \
+      var##_adapter_storage;                                              \
+  internal::adapter_traits<decltype(iname::var)>::module_adapter_t        \
+      &var##_adapter = *var##_adapter_storage
 #define NC_INTERNAL_TASK_MEMBER_LIST(iname, ...) \
   NC_INTERNAL_FOREACH_1ARG(NC_INTERNAL_TASK_MEMBER, iname, __VA_ARGS__)
 
 /// @brief Macro pair that initializes every given adapter with the adapted
 /// member.
-#define NC_INTERNAL_INIT_TASK_MEMBER(var) var##_adapter(var)
+#define NC_INTERNAL_INIT_TASK_MEMBER(var) var##_adapter_storage(var)
 #define NC_INTERNAL_INIT_TASK_MEMBERS(...) \
   NC_INTERNAL_FOREACH_LIST(NC_INTERNAL_INIT_TASK_MEMBER, __VA_ARGS__)
 
-/// @brief Macro pair that couples and synchronizes the given adapters using the
-/// references created by NC_INTERNAL_RR_MEMBER_REFS.
-#define NC_INTERNAL_COUPLE(var)                       \
-  refs.var##_adapter_ref.dynamic_bind(var##_adapter); \
-  all_synced &= refs.var##_adapter_ref.synced()
+/// @brief Macro pair that couples the given adapters using the references
+/// created by NC_INTERNAL_RR_MEMBER_REFS.
+#define NC_INTERNAL_COUPLE(var) \
+  refs.var##_adapter_ref.dynamic_bind(var##_adapter, sync)
 #define NC_INTERNAL_COUPLE_LIST(...) \
   NC_INTERNAL_FOREACH(NC_INTERNAL_COUPLE, __VA_ARGS__)
 
-/// @brief Macro pair that only couples the given adapters using the references
-/// created by NC_INTERNAL_RR_MEMBER_REFS.
-#define NC_INTERNAL_COUPLE_NOSYNC(var) \
-  refs.var##_adapter_ref.dynamic_bind(var##_adapter, false);
-#define NC_INTERNAL_COUPLE_NOSYNC_LIST(...) \
-  NC_INTERNAL_FOREACH(NC_INTERNAL_COUPLE_NOSYNC, __VA_ARGS__)
+/// @brief Macro pair that collects the synced events of the given adapters
+/// that require synchronization, which is decided at compile time.
+#define NC_INTERNAL_SYNCED(var)                             \
+  if constexpr (internal::adapter_sync_required_v<decltype( \
+                    refs.var##_adapter_ref)>)               \
+  all_synced &= refs.var##_adapter_ref.synced()
+#define NC_INTERNAL_SYNCED_LIST(...) \
+  NC_INTERNAL_FOREACH(NC_INTERNAL_SYNCED, __VA_ARGS__)
+
+/// @brief Macro to get the type of the reference to the given adapter created
+/// by NC_INTERNAL_RR_MEMBER_REFS.
+#define NC_INTERNAL_ADAPTER_REF_TYPE(var) decltype(refs.var##_adapter_ref)
+
+/// @brief Macro that couples the given adapters and waits until they are
+/// synchronized if sync is true. The event list is only created if any of the
+/// adapters requires synchronization, which is decided at compile time.
+#define NC_INTERNAL_COUPLE_ALL(...)                                        \
+  NC_INTERNAL_COUPLE_LIST(__VA_ARGS__)                                     \
+  if constexpr (internal::any_adapter_sync_required_v<                     \
+                    NC_INTERNAL_FOREACH_LIST(NC_INTERNAL_ADAPTER_REF_TYPE, \
+                                             __VA_ARGS__)>) {              \
+    if (sync) {                                                            \
+      sc_core::sc_event_and_list all_synced;                               \
+      NC_INTERNAL_SYNCED_LIST(__VA_ARGS__)                                 \
+      if (all_synced.size() > 0) wait(all_synced);                         \
+    }                                                                      \
+  }
 
 /// @brief Macro pair that decouples the given adapters using the references
 /// created by NC_INTERNAL_RR_MEMBER_REFS.
@@ -190,6 +220,19 @@
 #define NC_INTERNAL_DECOUPLE_LIST(...) \
   NC_INTERNAL_FOREACH(NC_INTERNAL_DECOUPLE, __VA_ARGS__)
 
+/// @brief Macro pair that statically binds the given adapters to the members
+/// they adapt.
+#define NC_INTERNAL_STATIC_BIND(var) var##_adapter.static_bind()
+#define NC_INTERNAL_STATIC_BIND_LIST(...) \
+  NC_INTERNAL_FOREACH(NC_INTERNAL_STATIC_BIND, __VA_ARGS__)
+
+/// @brief Macro pair that binds the given members of a module directly to those
+/// of the reconfiguration region using the references created by
+/// NC_INTERNAL_RR_MEMBER_REFS.
+#define NC_INTERNAL_FREEZE(var) refs.var##_adapter_ref.freeze(var##_adapter)
+#define NC_INTERNAL_FREEZE_LIST(...) \
+  NC_INTERNAL_FOREACH(NC_INTERNAL_FREEZE, __VA_ARGS__)
+
 /// @brief Macro pair that creates a configuration manager for every given
 /// sub-interface.
 #define NC_INTERNAL_CONF_MNGR(sname) conf_manager<sname> conf_##sname
@@ -219,15 +262,15 @@
 
 /// @brief Macro pair that creates register and configure functions at a split
 /// manager for every given sub-interface.
-#define NC_INTERNAL_REG_CONF_SPACE(sname)    \
-  template <class Module>                    \
-  void register_module_##sname() {           \
-    conf_##sname.register_module<Module>();  \
-  }                                          \
-                                             \
-  template <class Module>                    \
-  void configure_module_##sname() {          \
-    conf_##sname.configure_module<Module>(); \
+#define NC_INTERNAL_REG_CONF_SPACE(sname)           \
+  template <class Module>                           \
+  void register_module_##sname() {                  \
+    conf_##sname.register_module<Module>();         \
+  }                                                 \
+                                                    \
+  template <class Module>                           \
+  bool configure_module_##sname() {                 \
+    return conf_##sname.configure_module<Module>(); \
   }
 #define NC_INTERNAL_REG_CONF_SPACE_LIST(...) \
   NC_INTERNAL_FOREACH(NC_INTERNAL_REG_CONF_SPACE, __VA_ARGS__)
@@ -276,15 +319,9 @@
                                                                                \
     NC_INTERNAL_RR_MEMBER_LIST(iname, __VA_ARGS__)                             \
                                                                                \
-    void nc_couple_member_refs(configurable_base* t, bool sync) {              \
-      if (sync)                                                                \
-        t->nc_do_couple(member_refs);                                          \
-      else                                                                     \
-        t->nc_do_couple_no_sync(member_refs);                                  \
-    }                                                                          \
-                                                                               \
-    void nc_decouple_member_refs(configurable_base* t) {                       \
-      t->nc_do_decouple(member_refs);                                          \
+   protected:                                                                  \
+    void nc_bind_adapters() override {                                         \
+      NC_INTERNAL_STATIC_BIND_LIST(__VA_ARGS__)                                \
     }                                                                          \
                                                                                \
    public:                                                                     \
@@ -310,20 +347,27 @@
     void nc_couple(abstract_reconf_region_base* rr,                            \
                    bool sync) override final {                                 \
       sc_assert(m_configured_rr == nullptr);                                   \
-      auto rr_ = dynamic_cast<rr_base*>(rr);                                   \
-      sc_assert(rr_ != nullptr);                                               \
+      /* the configuration manager of this interface only couples with */      \
+      /* regions of this interface, thus no dynamic_cast is needed */          \
+      auto rr_ = static_cast<rr_base*>(rr);                                    \
                                                                                \
       m_configured_rr = rr;                                                    \
-      rr_->nc_couple_member_refs(this, sync);                                  \
+      nc_do_couple(rr_->member_refs, sync);                                    \
     }                                                                          \
                                                                                \
     void nc_decouple(abstract_reconf_region_base* rr) override final {         \
       sc_assert(m_configured_rr == rr);                                        \
-      auto rr_ = dynamic_cast<rr_base*>(rr);                                   \
-      sc_assert(rr_ != nullptr);                                               \
+      auto rr_ = static_cast<rr_base*>(rr);                                    \
                                                                                \
       m_configured_rr = nullptr;                                               \
-      rr_->nc_decouple_member_refs(this);                                      \
+      nc_do_decouple(rr_->member_refs);                                        \
+    }                                                                          \
+                                                                               \
+    void nc_freeze(abstract_reconf_region_base* rr) override final {           \
+      sc_assert(m_configured_rr == nullptr);                                   \
+      auto rr_ = static_cast<rr_base*>(rr);                                    \
+                                                                               \
+      nc_do_freeze(rr_->member_refs);                                          \
     }                                                                          \
                                                                                \
     abstract_reconf_region_base* m_configured_rr = nullptr;                    \
@@ -331,12 +375,13 @@
    protected:                                                                  \
     auto configured_rr() const { return m_configured_rr; }                     \
                                                                                \
-    virtual void nc_do_couple(rr_base::member_ref_struct& refs) = 0;           \
-                                                                               \
-    virtual void nc_do_couple_no_sync(rr_base::member_ref_struct& refs) = 0;   \
+    virtual void nc_do_couple(rr_base::member_ref_struct& refs,                \
+                              bool sync) = 0;                                  \
                                                                                \
     virtual void nc_do_decouple(rr_base::member_ref_struct& refs) = 0;         \
                                                                                \
+    virtual void nc_do_freeze(rr_base::member_ref_struct& refs) = 0;           \
+                                                                               \
    public:                                                                     \
     explicit configurable_base(const sc_core::sc_module_name& nm)              \
         : abstract_module_base(nm) {}                                          \
@@ -357,18 +402,20 @@
         : configurable_base(nm), NC_INTERNAL_INIT_TASK_MEMBERS(__VA_ARGS__) {} \
                                                                                \
    private:                                                                    \
-    void nc_do_couple(rr_base::member_ref_struct& refs) final {                \
-      sc_core::sc_event_and_list all_synced;                                   \
-      NC_INTERNAL_COUPLE_LIST(__VA_ARGS__)                                     \
-      wait(all_synced);                                                        \
-    }                                                                          \
-                                                                               \
-    void nc_do_couple_no_sync(rr_base::member_ref_struct& refs) final {        \
-      NC_INTERNAL_COUPLE_NOSYNC_LIST(__VA_ARGS__)                              \
+    void nc_do_couple(rr_base::member_ref_struct& refs, bool sync) final {     \
+      NC_INTERNAL_COUPLE_ALL(__VA_ARGS__)                                      \
     }                                                                          \
                                                                                \
     void nc_do_decouple(rr_base::member_ref_struct& refs) final {              \
       NC_INTERNAL_DECOUPLE_LIST(__VA_ARGS__)                                   \
+    }                                                                          \
+                                                                               \
+    void nc_bind_adapters() final {                                            \
+      NC_INTERNAL_STATIC_BIND_LIST(__VA_ARGS__)                                \
+    }                                                                          \
+                                                                               \
+    void nc_do_freeze(rr_base::member_ref_struct& refs) final {                \
+      NC_INTERNAL_FREEZE_LIST(__VA_ARGS__)                                     \
     }                                                                          \
   };
 
@@ -439,20 +486,23 @@
                                                                                \
       friend class base_interface::rr_base;                                    \
                                                                                \
-      void nc_do_couple(rr_base::member_ref_struct& refs) override {           \
-        sc_core::sc_event_and_list all_synced;                                 \
-        NC_INTERNAL_COUPLE_LIST(__VA_ARGS__)                                   \
-        wait(all_synced);                                                      \
-      }                                                                        \
-                                                                               \
-      void nc_do_couple_no_sync(rr_base::member_ref_struct& refs) override {   \
-        NC_INTERNAL_COUPLE_NOSYNC_LIST(__VA_ARGS__)                            \
+      void nc_do_couple(rr_base::member_ref_struct& refs,                      \
+                        bool sync) override {                                  \
+        NC_INTERNAL_COUPLE_ALL(__VA_ARGS__)                                    \
       }                                                                        \
                                                                                \
       void nc_do_decouple(rr_base::member_ref_struct& refs) override {         \
         NC_INTERNAL_DECOUPLE_LIST(__VA_ARGS__)                                 \
       }                                                                        \
                                                                                \
+      void nc_bind_adapters() override {                                       \
+        NC_INTERNAL_STATIC_BIND_LIST(__VA_ARGS__)                              \
+      }                                                                        \
+                                                                               \
+      void nc_do_freeze(rr_base::member_ref_struct& refs) override {           \
+        NC_INTERNAL_FREEZE_LIST(__VA_ARGS__)                                   \
+      }                                                                        \
+                                                                               \
      public:                                                                   \
       explicit module_base(const sc_core::sc_module_name& nm)                  \
           : configurable_base(nm),                                             \
@@ -481,22 +531,28 @@
    private:                                                                   \
     typedef base_interface::rr_base rr_base;                                  \
                                                                               \
-    void nc_do_couple(rr_base::member_ref_struct& refs) override {            \
+    void nc_do_couple(rr_base::member_ref_struct& refs, bool sync) override { \
+      /* nothing to couple here, but we connect our conf_manager to the rr */ \
       (void)refs;                                                             \
+      (void)sync;                                                             \
       NC_INTERNAL_CONF_CONNECT_LIST(__VA_ARGS__)                              \
     }                                                                         \
                                                                               \
-    void nc_do_couple_no_sync(rr_base::member_ref_struct& refs) override {    \
-      /* nothing to couple here, but we connect our conf_manager to the rr */ \
-      nc_do_couple(refs);                                                     \
-    }                                                                         \
-                                                                              \
     void nc_do_decouple(rr_base::member_ref_struct& refs) override {          \
       (void)refs;                                                             \
       /* nothing to decouple here, don't disconnect conf_manager yet, will be \
        * needed for unload */                                                 \
     }                                                                         \
                                                                               \
+    void nc_bind_adapters() override {                                        \
+      /* no adapters, the conf_managers bind the adapters of their modules */ \
+    }                                                                         \
+                                                                              \
+    void nc_do_freeze(rr_base::member_ref_struct& refs) override {            \
+      (void)refs;                                                             \
+      SC_REPORT_ERROR(name(), "A split manager cannot be frozen.");           \
+    }                                                                         \
+                                                                              \
     void on_activate() override {                                             \
       /* TODO: preloads should be activated here */                           \
     }                                                                         \
@@ -12,6 +12,7 @@
 
 #include "forwarding/adapters.h"
 #include "nc_definitions.h"
+#include "nc_member_list.h"
 
 /**
  * Base class for every reconfiguration interface.
@@ -0,0 +1,417 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+#ifndef NC_MEMBER_LIST_H_
+#define NC_MEMBER_LIST_H_
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "forwarding/adapter_traits.h"
+#include "forwarding/nc_adapter_pool.h"
+#include "modules/abstract_module_base.h"
+#include "region/abstract_reconf_region_base.h"
+
+namespace internal {
+
+/**
+ * Helper struct to retrieve the class and the member type of a pointer to a
+ * data member.
+ *
+ * @tparam T the type of the member pointer
+ */
+template <typename T>
+struct nc_member_pointer_traits {};
+
+/**
+ * Specialization for pointers to data members of type T in class Class.
+ */
+template <typename Class, typename T>
+struct nc_member_pointer_traits<T Class::*> {
+  typedef Class class_type;
+  typedef T member_type;
+};
+
+/// @brief The type of the member that the given member pointer points to.
+template <auto Member>
+using nc_member_t =
+    typename nc_member_pointer_traits<decltype(Member)>::member_type;
+
+/**
+ * Compile-time description of the members of a reconfiguration interface.
+ * The members are given as pointers to data members of the interface class, so
+ * there is no limit for the number of members.
+ *
+ * @tparam Interface the interface class that contains the members
+ * @tparam Members pointers to the members of the interface class
+ */
+template <class Interface, auto... Members>
+struct nc_member_list {
+  static_assert(sizeof...(Members) > 0,
+                "An interface needs to register at least one member.");
+  static_assert(
+      (std::is_base_of<typename nc_member_pointer_traits<
+                           decltype(Members)>::class_type,
+                       Interface>::value &&
+       ...),
+      "All registered members need to belong to the interface.");
+  static_assert(
+      (std::is_base_of<typename adapter_traits<
+                           nc_member_t<Members>>::rr_exposed_t,
+                       nc_member_t<Members>>::value &&
+       ...) &&
+          (std::is_base_of<typename adapter_traits<
+                               nc_member_t<Members>>::module_exposed_t,
+                           nc_member_t<Members>>::value &&
+           ...),
+      "Members registered via NC_INTERFACE_MEMBERS are inherited from the "
+      "interface and thus need to be usable as their exposed type.");
+
+  /// @brief the interface class that contains the members
+  typedef Interface interface_type;
+
+  /// @brief the number of members
+  static constexpr std::size_t size = sizeof...(Members);
+};
+
+/**
+ * Storage for a single adapter, which is allocated from the adapter pool. The
+ * index makes the slot types of an adapter set distinct, even if two members
+ * have the same type.
+ *
+ * @tparam I the index of the adapted member in the member list
+ * @tparam Adapter the type of the adapter
+ */
+template <std::size_t I, class Adapter>
+struct nc_adapter_slot {
+  /// @brief the adapter instance
+  nc_pooled_adapter<Adapter> adapter;
+
+  /**
+   * Construct the adapter with the given arguments.
+   *
+   * @param args the arguments that are forwarded to the adapter's constructor
+   */
+  template <typename... Args>
+  explicit nc_adapter_slot(Args &&...args)
+      : adapter(std::forward<Args>(args)...) {}
+};
+
+/**
+ * Retrieve the adapter from the slot with index I. The adapter type is deduced
+ * from the slot that an adapter set derives from.
+ */
+template <std::size_t I, class Adapter>
+Adapter &nc_get_adapter(nc_adapter_slot<I, Adapter> &slot) {
+  return *slot.adapter;
+}
+
+template <class List,
+          class Indices = std::make_index_sequence<List::size>>
+class nc_rr_adapter_set;
+
+/**
+ * The adapters of a reconfiguration region, one for every member in the
+ * member list. An instance of this class is passed to a module for coupling
+ * and decoupling adapters and thus serves the same purpose as the member_ref
+ * struct generated by NC_INTERFACE_REGISTER.
+ *
+ * @tparam Interface the interface class that contains the members
+ * @tparam Members pointers to the members of the interface class
+ */
+template <class Interface, auto... Members, std::size_t... Is>
+class nc_rr_adapter_set<nc_member_list<Interface, Members...>,
+                        std::index_sequence<Is...>>
+    : public nc_adapter_slot<
+          Is, typename adapter_traits<nc_member_t<Members>>::rr_adapter_t>... {
+ public:
+  /**
+   * Create an adapter for every member of the given interface instance.
+   *
+   * @param rr the reconfiguration region that contains the adapters
+   * @param members the members that are exposed by the reconfiguration region
+   */
+  nc_rr_adapter_set(abstract_reconf_region_base &rr, Interface &members)
+      : nc_adapter_slot<Is, typename adapter_traits<
+                                nc_member_t<Members>>::rr_adapter_t>(
+            rr, members.*Members)... {}
+
+  /**
+   * Get the adapter of the member with index I.
+   */
+  template <std::size_t I>
+  auto &get() {
+    return nc_get_adapter<I>(*this);
+  }
+
+  /**
+   * Statically bind all adapters to the members they adapt.
+   */
+  void static_bind() { (get<Is>().static_bind(), ...); }
+};
+
+template <class List,
+          class Indices = std::make_index_sequence<List::size>>
+class nc_module_adapter_set;
+
+/**
+ * The adapters of a module, one for every member in the member list.
+ *
+ * @tparam Interface the interface class that contains the members
+ * @tparam Members pointers to the members of the interface class
+ */
+template <class Interface, auto... Members, std::size_t... Is>
+class nc_module_adapter_set<nc_member_list<Interface, Members...>,
+                            std::index_sequence<Is...>>
+    : public nc_adapter_slot<
+          Is,
+          typename adapter_traits<nc_member_t<Members>>::module_adapter_t>... {
+ public:
+  /**
+   * Create an adapter for every member of the given interface instance.
+   *
+   * @param members the members that are exposed by the module
+   */
+  explicit nc_module_adapter_set(Interface &members)
+      : nc_adapter_slot<Is, typename adapter_traits<
+                                nc_member_t<Members>>::module_adapter_t>(
+            members.*Members)... {}
+
+  /**
+   * Get the adapter of the member with index I.
+   */
+  template <std::size_t I>
+  auto &get() {
+    return nc_get_adapter<I>(*this);
+  }
+
+  /**
+   * Statically bind all adapters to the members they adapt.
+   */
+  void static_bind() { (get<Is>().static_bind(), ...); }
+};
+
+template <class List>
+class nc_configurable_base;
+
+template <class List>
+class nc_rr_base;
+
+template <class List>
+class nc_module_base;
+
+/**
+ * Template counterpart of the rr_base class generated by
+ * NC_INTERFACE_REGISTER. It inherits the members that are exposed to the
+ * static design from the interface class and contains an adapter for each of
+ * them.
+ *
+ * @tparam Interface the interface class that contains the members
+ * @tparam Members pointers to the members of the interface class
+ */
+template <class Interface, auto... Members>
+class nc_rr_base<nc_member_list<Interface, Members...>>
+    : public abstract_reconf_region_base,
+      public Interface {
+  typedef nc_member_list<Interface, Members...> list_type;
+
+  friend class nc_configurable_base<list_type>;
+
+ public:
+  /// @brief The set of adapters that is passed to a module for coupling and
+  /// decoupling.
+  typedef nc_rr_adapter_set<list_type> member_ref_struct;
+
+  /**
+   * Create the reconfiguration region base.
+   *
+   * @param nm the name of the module
+   * @param base_module the module in which the reconfiguration region is nested
+   * or nullptr if it is in the static design
+   */
+  explicit nc_rr_base(const sc_core::sc_module_name &nm,
+                      abstract_module_base *base_module)
+      : abstract_reconf_region_base(nm, base_module),
+        Interface(),
+        member_refs(*this, *this) {}
+
+ protected:
+  void nc_bind_adapters() override { member_refs.static_bind(); }
+
+ private:
+  /// @brief the adapters for the members exposed to the static design
+  member_ref_struct member_refs;
+};
+
+/**
+ * Template counterpart of the configurable_base class generated by
+ * NC_INTERFACE_REGISTER. It is the base class for everything that can be
+ * configured at a reconfiguration region of the interface.
+ *
+ * @tparam Interface the interface class that contains the members
+ * @tparam Members pointers to the members of the interface class
+ */
+template <class Interface, auto... Members>
+class nc_configurable_base<nc_member_list<Interface, Members...>>
+    : public abstract_module_base {
+  typedef nc_member_list<Interface, Members...> list_type;
+  typedef nc_rr_base<list_type> rr_base;
+
+  void nc_couple(abstract_reconf_region_base *rr, bool sync) override final {
+    sc_assert(m_configured_rr == nullptr);
+    // the configuration manager of this interface only couples with regions
+    // of this interface, thus no dynamic_cast is needed
+    auto rr_ = static_cast<rr_base *>(rr);
+
+    m_configured_rr = rr;
+    nc_do_couple(rr_->member_refs, sync);
+  }
+
+  void nc_decouple(abstract_reconf_region_base *rr) override final {
+    sc_assert(m_configured_rr == rr);
+    auto rr_ = static_cast<rr_base *>(rr);
+
+    m_configured_rr = nullptr;
+    nc_do_decouple(rr_->member_refs);
+  }
+
+  void nc_freeze(abstract_reconf_region_base *rr) override final {
+    sc_assert(m_configured_rr == nullptr);
+    auto rr_ = static_cast<rr_base *>(rr);
+
+    nc_do_freeze(rr_->member_refs);
+  }
+
+  abstract_reconf_region_base *m_configured_rr = nullptr;
+
+ protected:
+  auto configured_rr() const { return m_configured_rr; }
+
+  virtual void nc_do_couple(typename rr_base::member_ref_struct &refs,
+                            bool sync) = 0;
+
+  virtual void nc_do_decouple(typename rr_base::member_ref_struct &refs) = 0;
+
+  virtual void nc_do_freeze(typename rr_base::member_ref_struct &refs) = 0;
+
+ public:
+  explicit nc_configurable_base(const sc_core::sc_module_name &nm)
+      : abstract_module_base(nm) {}
+};
+
+/**
+ * Template counterpart of the module_base class generated by
+ * NC_INTERFACE_REGISTER. It inherits the members that are exposed to the
+ * module from the interface class, contains an adapter for each of them and
+ * implements the coupling and decoupling logic.
+ *
+ * @tparam Interface the interface class that contains the members
+ * @tparam Members pointers to the members of the interface class
+ */
+template <class Interface, auto... Members>
+class nc_module_base<nc_member_list<Interface, Members...>>
+    : public nc_configurable_base<nc_member_list<Interface, Members...>>,
+      public Interface {
+  typedef nc_member_list<Interface, Members...> list_type;
+  typedef nc_configurable_base<list_type> base_type;
+  typedef typename nc_rr_base<list_type>::member_ref_struct member_ref_struct;
+  typedef std::make_index_sequence<sizeof...(Members)> indices;
+
+  /// @brief the adapters for the members exposed to the module
+  nc_module_adapter_set<list_type> m_adapters;
+
+  static const char *default_name() {
+    return sc_core::sc_gen_unique_name("module");
+  }
+
+  /**
+   * Add the synced event of the member with index I to the given list if its
+   * adapter requires synchronization.
+   */
+  template <std::size_t I>
+  void nc_add_synced(member_ref_struct &refs,
+                     sc_core::sc_event_and_list &all_synced) {
+    auto &rr_adapter = refs.template get<I>();
+    if constexpr (adapter_sync_required_v<decltype(rr_adapter)>) {
+      all_synced &= rr_adapter.synced();
+    }
+  }
+
+  /**
+   * Couple the adapters of all members and wait until they are synchronized if
+   * sync is true. The event list is only created if any of the adapters
+   * requires synchronization, which is decided at compile time.
+   */
+  template <std::size_t... Is>
+  void nc_couple_members(member_ref_struct &refs, bool sync,
+                         std::index_sequence<Is...>) {
+    (refs.template get<Is>().dynamic_bind(m_adapters.template get<Is>(), sync),
+     ...);
+    if constexpr (any_adapter_sync_required_v<decltype(
+                      refs.template get<Is>())...>) {
+      if (sync) {
+        sc_core::sc_event_and_list all_synced;
+        (nc_add_synced<Is>(refs, all_synced), ...);
+        if (all_synced.size() > 0) this->wait(all_synced);
+      }
+    }
+  }
+
+  template <std::size_t... Is>
+  void nc_decouple_members(member_ref_struct &refs,
+                           std::index_sequence<Is...>) {
+    (refs.template get<Is>().dynamic_unbind(m_adapters.template get<Is>()),
+     ...);
+  }
+
+  template <std::size_t... Is>
+  void nc_freeze_members(member_ref_struct &refs, std::index_sequence<Is...>) {
+    (refs.template get<Is>().freeze(m_adapters.template get<Is>()), ...);
+  }
+
+ public:
+  explicit nc_module_base(const sc_core::sc_module_name &nm = default_name())
+      : base_type(nm), Interface(), m_adapters(*this) {}
+
+ private:
+  void nc_do_couple(member_ref_struct &refs, bool sync) final {
+    nc_couple_members(refs, sync, indices());
+  }
+
+  void nc_do_decouple(member_ref_struct &refs) final {
+    nc_decouple_members(refs, indices());
+  }
+
+  void nc_bind_adapters() final { m_adapters.static_bind(); }
+
+  void nc_do_freeze(member_ref_struct &refs) final {
+    nc_freeze_members(refs, indices());
+  }
+};
+
+}  // namespace internal
+
+/**
+ * Register the members of a reconfiguration interface using pointers to its
+ * data members, e.g.
+ * NC_INTERFACE_MEMBERS(my_interface, &my_interface::in1, &my_interface::out).
+ * This creates the same classes rr_base, configurable_base and module_base
+ * within the interface class as NC_INTERFACE_REGISTER, but they are generated
+ * by templates instead of macros. Thus, there is no limit for the number of
+ * members and every member only adds one template argument.
+ * The generated rr_base and module_base inherit the members from the interface
+ * class, so the adapters of all members need to expose the declared member
+ * type. Splitting interfaces registered this way with NC_SPLIT_INTERFACE is not
+ * supported yet.
+ */
+#define NC_INTERFACE_MEMBERS(iname, ...)                                  \
+  typedef internal::nc_member_list<iname, __VA_ARGS__> nc_members;        \
+  typedef internal::nc_rr_base<nc_members> rr_base;                       \
+  typedef internal::nc_configurable_base<nc_members> configurable_base;   \
+  typedef internal::nc_module_base<nc_members> module_base
+
+#endif  // NC_MEMBER_LIST_H_
@@ -6,6 +6,8 @@
  */
 #include "abstract_reconf_region_base.h"
 
+#include <algorithm>
+
 #include "modules/abstract_module_base.h"
 
 abstract_reconf_region_base::abstract_reconf_region_base(
@@ -15,3 +17,97 @@ abstract_reconf_region_base::abstract_reconf_region_base(
     base_module->register_nested_rr(this);
   }
 }
+
+abstract_reconf_region_base::config_socket_type &
+abstract_reconf_region_base::enable_bitstream_fetch(size_t burst_bytes) {
+  sc_assert(burst_bytes > 0 && "Burst size has to be larger than zero.");
+  if (m_config_isock == nullptr) {
+    sc_core::sc_status status = sc_core::sc_get_status();
+    if (status != sc_core::SC_ELABORATION &&
+        status != sc_core::SC_BEFORE_END_OF_ELABORATION) {
+      SC_REPORT_ERROR(
+          name(), "Bitstream fetch can only be enabled during elaboration.");
+    }
+    // create the socket as a child of the region instead of the caller
+    sc_core::sc_get_curr_simcontext()->hierarchy_push(this);
+    m_config_isock.reset(new config_socket_type("config_isock"));
+    sc_core::sc_get_curr_simcontext()->hierarchy_pop();
+    m_config_isock->bind(m_config_bw);
+  }
+  m_fetch_burst_bytes = burst_bytes;
+  return *m_config_isock;
+}
+
+void abstract_reconf_region_base::end_of_elaboration() {
+  sc_core::sc_module::end_of_elaboration();
+  if (m_config_isock != nullptr && m_config_isock->size() == 0) {
+    SC_REPORT_ERROR(name(),
+                    "Bitstream fetch is enabled, but config_isock is not bound "
+                    "to a configuration memory.");
+  }
+}
+
+void abstract_reconf_region_base::notify_reconf_phase(reconf_phase phase) {
+  if (sc_core::sc_is_running()) {
+    switch (phase) {
+      case reconf_phase::begin:
+        m_reconf_begin.notify(sc_core::SC_ZERO_TIME);
+        break;
+      case reconf_phase::unloaded:
+        m_unloaded.notify(sc_core::SC_ZERO_TIME);
+        break;
+      case reconf_phase::load_done:
+        m_load_done.notify(sc_core::SC_ZERO_TIME);
+        break;
+      case reconf_phase::module_active:
+        m_module_active.notify(sc_core::SC_ZERO_TIME);
+        break;
+      case reconf_phase::end:
+        m_reconf_end.notify(sc_core::SC_ZERO_TIME);
+        break;
+    }
+  }
+  for (auto &listener : m_reconf_listeners) {
+    listener(phase, m_reconf_old_module, m_reconf_new_module);
+  }
+}
+
+bool abstract_reconf_region_base::fetch_bitstream(
+    sc_dt::uint64 address, size_t bytes, const sc_core::sc_time &port_time) {
+  std::vector<unsigned char> buffer(m_fetch_burst_bytes);
+  sc_core::sc_time port_start = sc_core::sc_time_stamp();
+  sc_core::sc_time port_end = port_start;
+
+  for (size_t offset = 0; offset < bytes; offset += m_fetch_burst_bytes) {
+    // only one fetched burst waits for the port while the next one is fetched
+    if (port_start > sc_core::sc_time_stamp() &&
+        !wait_load(port_start - sc_core::sc_time_stamp())) {
+      return false;
+    }
+
+    size_t length = std::min(m_fetch_burst_bytes, bytes - offset);
+    tlm::tlm_generic_payload trans;
+    sc_core::sc_time delay = sc_core::SC_ZERO_TIME;
+    trans.set_command(tlm::TLM_READ_COMMAND);
+    trans.set_address(address + offset);
+    trans.set_data_ptr(buffer.data());
+    trans.set_data_length(length);
+    trans.set_streaming_width(length);
+    trans.set_response_status(tlm::TLM_INCOMPLETE_RESPONSE);
+    sc_assert(m_config_isock != nullptr && m_config_isock->size() > 0 &&
+              "Bitstream fetch needs config_isock to be bound.");
+    (*m_config_isock)->b_transport(trans, delay);
+    if (trans.is_response_error()) {
+      SC_REPORT_ERROR(name(), "Fetching bitstream from memory failed.");
+      return false;
+    }
+    if (!wait_load(delay)) return false;
+    set_load_progress(static_cast<double>(offset + length) / bytes);
+
+    port_start = std::max(sc_core::sc_time_stamp(), port_end);
+    port_end = port_start + port_time * (static_cast<double>(length) / bytes);
+  }
+
+  return port_end <= sc_core::sc_time_stamp() ||
+         wait_load(port_end - sc_core::sc_time_stamp());
+}
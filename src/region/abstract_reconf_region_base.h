@@ -9,10 +9,19 @@
 
 #include <systemc.h>
 
+#include <functional>
+#include <memory>
+#include <tlm>
+#include <vector>
+
 class reconf_lock;
 class conf_manager_base;
 class abstract_module_base;
 
+namespace internal {
+class rr_target_socket_adapter;
+}
+
 /**
  * Abstract base for every specialized reconfiguration region base generated
  * from an interface description. It contains logic for module management which
@@ -23,8 +32,27 @@ class abstract_module_base;
 class abstract_reconf_region_base : public ::sc_core::sc_module {
   friend class reconf_lock;           // for counting transactions
   friend class conf_manager_base;     // for marking (nested) reconfiguration
-  friend class abstract_module_base;  // for calling do_preload
+  // for calling do_preload, do_nested_quiesce and do_nested_unload
+  friend class abstract_module_base;
+  // for checking whether a module or a software model can serve transactions
+  friend class internal::rr_target_socket_adapter;
+
+ public:
+  /// @brief The phases of a reconfiguration, in the order they are reached.
+  enum class reconf_phase {
+    /// @brief the reconfiguration started
+    begin,
+    /// @brief the old module was decoupled and deactivated
+    unloaded,
+    /// @brief the bitstream of the new module was loaded completely
+    load_done,
+    /// @brief the new module was coupled and activated
+    module_active,
+    /// @brief the reconfiguration ended, also if its load was aborted
+    end
+  };
 
+ private:
   /**
    * Mark that an transaction was started by the configured module, but only if
    * transactions are currently not blocked.
@@ -47,17 +75,30 @@ class abstract_reconf_region_base : public ::sc_core::sc_module {
         m_active_trans_count > 0 &&
         "Signaled end of transaction when there is no transaction on progress");
     --m_active_trans_count;
+    // only needed by demand configuration, which waits for running
+    // transactions before it replaces the configured module
+    if (m_active_trans_count == 0 && m_demand_configuration) {
+      m_transactions_done.notify(sc_core::SC_ZERO_TIME);
+    }
   }
 
  protected:
   /**
    * Mark that the reconfiguration process has been started.
+   *
+   * @param old_module the module configured before the reconfiguration
+   * @param new_module the module that is configured by the reconfiguration,
+   * nullptr if the region is left empty
    */
-  inline void mark_reconf_begin() {
+  inline void mark_reconf_begin(abstract_module_base *old_module,
+                                abstract_module_base *new_module) {
     if (m_reconfiguring) {
       SC_REPORT_ERROR(name(), "Reconfiguration already in progress.");
     }
     m_reconfiguring = true;
+    m_reconf_old_module = old_module;
+    m_reconf_new_module = new_module;
+    notify_reconf_phase(reconf_phase::begin);
   }
 
   /**
@@ -66,6 +107,27 @@ class abstract_reconf_region_base : public ::sc_core::sc_module {
   inline void mark_reconf_end() {
     sc_assert(m_reconfiguring && "No reconfiguration in progress.");
     m_reconfiguring = false;
+    notify_reconf_phase(reconf_phase::end);
+  }
+
+  /**
+   * Mark that a module is loaded into the shadow context. The region is not
+   * reconfiguring meanwhile, since its configured module keeps serving.
+   */
+  inline void mark_shadow_load_begin() {
+    if (m_reconfiguring || m_shadow_loading) {
+      SC_REPORT_ERROR(name(), "Reconfiguration already in progress.");
+    }
+    m_shadow_loading = true;
+  }
+
+  /**
+   * Mark that the load into the shadow context has ended.
+   */
+  inline void mark_shadow_load_end() {
+    sc_assert(m_shadow_loading && "No shadow load in progress.");
+    m_shadow_loading = false;
+    m_shadow_load_end.notify(sc_core::SC_ZERO_TIME);
   }
 
   /**
@@ -103,6 +165,32 @@ class abstract_reconf_region_base : public ::sc_core::sc_module {
    */
   inline bool transactions_blocked() const { return m_transactions_blocked; }
 
+  /**
+   * Check whether there are transactions in progress that were started by the
+   * configured module.
+   * @return true if transactions are in progress, false otherwise
+   */
+  inline bool has_active_transactions() const {
+    return m_active_trans_count != 0;
+  }
+
+  /**
+   * Get the event that is triggered when the last transaction in progress has
+   * ended. It is only triggered while demand configuration is enabled.
+   * @return the event
+   */
+  const sc_core::sc_event &transactions_done_event() const {
+    return m_transactions_done;
+  }
+
+  /**
+   * Enable or disable demand configuration.
+   * @param enable true to enable demand configuration, false to disable it
+   */
+  void set_demand_configuration(bool enable) {
+    m_demand_configuration = enable;
+  }
+
   /**
    * Check whether the reconfiguration region is nested in a module or at
    * top-level.
@@ -110,12 +198,155 @@ class abstract_reconf_region_base : public ::sc_core::sc_module {
    */
   bool is_nested_rr() const { return m_base_module != nullptr; }
 
+  /**
+   * Enable or disable the software fallback.
+   * @param enable true to enable the software fallback, false to disable it
+   */
+  void set_software_fallback(bool enable) { m_software_fallback = enable; }
+
+  /**
+   * Serve a blocking transaction by the software model of the module that it
+   * demands or, if it demands none, of the module that is currently
+   * configured.
+   *
+   * @param trans a TLM transaction payload instance
+   * @param t a SystemC time
+   * @return true if the transaction was served, false if there is no software
+   * model for it
+   */
+  virtual bool software_b_transport(tlm::tlm_generic_payload &trans,
+                                    sc_core::sc_time &t) = 0;
+
+  /**
+   * Serve a debug transaction by a software model, which is selected like for
+   * software_b_transport.
+   *
+   * @param trans a TLM transaction payload instance
+   * @param count the number of transferred bytes
+   * @return true if the transaction was served, false if there is no software
+   * model for it
+   */
+  virtual bool software_transport_dbg(tlm::tlm_generic_payload &trans,
+                                      unsigned int &count) = 0;
+
+  /**
+   * Fetch a bitstream from the configuration memory through config_isock and
+   * stream it into the configuration port. The bitstream is read in bursts,
+   * and the next burst is fetched while the port writes the previous one. The
+   * port needs the given time for the whole bitstream, so the fetch only
+   * prolongs the reconfiguration when the memory is slower or contended.
+   * Must be called from a thread process.
+   *
+   * The load progress is updated for every fetched burst, and the fetch stops
+   * when the load is aborted.
+   *
+   * @param address the address of the bitstream in the configuration memory
+   * @param bytes the number of bytes to fetch
+   * @param port_time the time the configuration port needs to write all bytes
+   * @return false if the load was aborted
+   * @see abstract_reconf_region_base#enable_bitstream_fetch
+   */
+  bool fetch_bitstream(sc_dt::uint64 address, size_t bytes,
+                       const sc_core::sc_time &port_time);
+
+  /**
+   * Mark that the bitstream of a module starts to be written, so that the load
+   * can be aborted.
+   */
+  inline void begin_load() {
+    m_loading = true;
+    m_abort_requested = false;
+    m_load_progress = 0;
+  }
+
+  /**
+   * Mark that the bitstream of a module was written or the load was aborted.
+   */
+  inline void end_load() { m_loading = false; }
+
+  /**
+   * Wait for the given time while a bitstream is written, unless the load is
+   * aborted. Must be called from a thread process.
+   *
+   * @param t the time to wait
+   * @return false if the load was aborted
+   */
+  bool wait_load(const sc_core::sc_time &t) {
+    if (!m_abort_requested) sc_core::wait(t, m_abort);
+    return !m_abort_requested;
+  }
+
+  /**
+   * Set the fraction of the bitstream that was written and notify the
+   * observers of the load progress.
+   *
+   * @param progress the fraction between 0 and 1
+   */
+  void set_load_progress(double progress) {
+    m_load_progress = progress;
+    m_load_progress_event.notify(sc_core::SC_ZERO_TIME);
+  }
+
+  /**
+   * Trigger the event of the given phase of the ongoing reconfiguration and
+   * call all reconfiguration listeners.
+   *
+   * @param phase the phase that was reached
+   */
+  void notify_reconf_phase(reconf_phase phase);
+
+  /**
+   * Call all module listeners with the given module.
+   *
+   * @param module the module that was configured or unloaded
+   * @param configured true if the module was configured, false if it was
+   * unloaded
+   */
+  void notify_module_listeners(abstract_module_base *module, bool configured) {
+    for (auto &listener : m_module_listeners) listener(module, configured);
+  }
+
   /**
    * Actually load the module that was registered for preload.
    */
   virtual void do_preload() = 0;
 
+  /**
+   * Quiesce the current module, because the module in which the
+   * reconfiguration region is nested is about to be unloaded. Called before
+   * the containing module is deactivated, so that do_nested_unload does not
+   * need to wait.
+   */
+  virtual void do_nested_quiesce() = 0;
+
+  /**
+   * Unload the current module, because the module in which the reconfiguration
+   * region is nested is deactivated. Unlike unload_module, this also unloads a
+   * frozen module, which is loaded again by do_preload on the next activation.
+   */
+  virtual void do_nested_unload() = 0;
+
+  /**
+   * Statically bind the adapters of the reconfiguration region to the exposed
+   * members, so that modules can be coupled to them later on. This is done
+   * before the end of elaboration unless a module was frozen at the region.
+   */
+  virtual void nc_bind_adapters() = 0;
+
  public:
+  /// @brief Function that is called when a module was configured at or
+  /// unloaded from the reconfiguration region.
+  typedef std::function<void(abstract_module_base *module, bool configured)>
+      module_listener_t;
+
+  /// @brief Function that is called whenever a reconfiguration reaches a
+  /// phase, with the module configured before and the one configured by the
+  /// reconfiguration. Either module may be nullptr.
+  typedef std::function<void(reconf_phase phase,
+                             abstract_module_base *old_module,
+                             abstract_module_base *new_module)>
+      reconf_listener_t;
+
   /**
    * Constructor for an abstract reconfiguration region.
    * The given name will be passed to the sc_module constructor.
@@ -129,30 +360,279 @@ class abstract_reconf_region_base : public ::sc_core::sc_module {
   abstract_reconf_region_base(const sc_core::sc_module_name& name,
                               abstract_module_base* base_module);
 
+  /// @brief The type of the socket through which bitstreams are fetched. Its
+  /// binding is checked at the end of elaboration with a clearer message than
+  /// the one of SystemC.
+  typedef tlm::tlm_initiator_socket<32, tlm::tlm_base_protocol_types, 1,
+                                    sc_core::SC_ZERO_OR_MORE_BOUND>
+      config_socket_type;
+
   /**
    * Unload the currently configured module.
    */
   virtual void unload_module() = 0;
 
+  /**
+   * Enable fetching bitstreams from a configuration memory. Reconfigurations
+   * then read the bitstream through the returned socket, so that they compete
+   * with other traffic to the memory, instead of only waiting for the load
+   * time. The socket is only created by this call, which is thus only possible
+   * during elaboration, and it needs to be bound to the memory.
+   *
+   * @param burst_bytes the number of bytes read by one transaction
+   * @return the socket named config_isock, which needs to be bound
+   */
+  config_socket_type &enable_bitstream_fetch(size_t burst_bytes);
+
+  /**
+   * Get the socket through which bitstreams are fetched.
+   *
+   * @return the socket created by enable_bitstream_fetch
+   */
+  config_socket_type &get_config_isock() {
+    sc_assert(m_config_isock != nullptr &&
+              "Bitstream fetch has not been enabled.");
+    return *m_config_isock;
+  }
+
+  /**
+   * Check whether bitstreams are fetched from a configuration memory.
+   * @return true if bitstreams are fetched, false otherwise
+   */
+  inline bool is_bitstream_fetch() const { return m_fetch_burst_bytes != 0; }
+
+  /**
+   * Abort the load of the module that is being configured, if its bitstream is
+   * written at the moment. The region is left empty, with the module neither
+   * coupled nor activated, like after unload_module. Unloading the previous
+   * module and transferring contexts cannot be aborted.
+   *
+   * @return true if a load was aborted, false if there was none to abort
+   */
+  bool abort_configuration() {
+    if (!m_loading || m_abort_requested) return false;
+    m_abort_requested = true;
+    m_abort.notify();
+    return true;
+  }
+
+  /**
+   * Get the fraction of the bitstream that was written by the current or, if
+   * there is none, the last load.
+   * @return the load progress between 0 and 1
+   */
+  inline double get_load_progress() const { return m_load_progress; }
+
+  /**
+   * Get the event that is triggered whenever a load progressed, a.k.a. after
+   * every written chunk of the bitstream.
+   * @return the event
+   */
+  const sc_core::sc_event &load_progress_event() const {
+    return m_load_progress_event;
+  }
+
+  /**
+   * Add a listener that is called whenever a module was configured at or
+   * unloaded from this reconfiguration region. A configured module is reported
+   * after it was activated, an unloaded module after it was deactivated.
+   *
+   * @param listener the listener to add
+   */
+  void add_module_listener(module_listener_t listener) {
+    m_module_listeners.push_back(std::move(listener));
+  }
+
+  /**
+   * Add a listener that is called whenever a reconfiguration of this region
+   * reaches a phase. Listeners are called right away from the reconfiguring
+   * process, so they must not wait.
+   *
+   * @param listener the listener to add
+   */
+  void add_reconf_listener(reconf_listener_t listener) {
+    m_reconf_listeners.push_back(std::move(listener));
+  }
+
+  /**
+   * Get the event that is triggered when a reconfiguration process has
+   * started.
+   * @return the event
+   */
+  const sc_core::sc_event &reconf_begin_event() const {
+    return m_reconf_begin;
+  }
+
+  /**
+   * Get the event that is triggered when a module was unloaded by a
+   * reconfiguration.
+   * @return the event
+   */
+  const sc_core::sc_event &unloaded_event() const { return m_unloaded; }
+
+  /**
+   * Get the event that is triggered when the bitstream of a module was
+   * loaded completely.
+   * @return the event
+   */
+  const sc_core::sc_event &load_done_event() const { return m_load_done; }
+
+  /**
+   * Get the event that is triggered when a configured module was coupled and
+   * activated.
+   * @return the event
+   */
+  const sc_core::sc_event &module_active_event() const {
+    return m_module_active;
+  }
+
   /**
    * Check whether there is an reconfiguration process ongoing.
    * @return
    */
   inline bool is_reconfiguring() const { return m_reconfiguring; }
 
+  /**
+   * Get the event that is triggered when a reconfiguration process has ended.
+   * @return the event
+   */
+  const sc_core::sc_event &reconf_end_event() const { return m_reconf_end; }
+
+  /**
+   * Check whether a module is loaded into the shadow context, while the
+   * configured module keeps serving.
+   * @return true if a shadow load is ongoing, false otherwise
+   */
+  inline bool is_shadow_loading() const { return m_shadow_loading; }
+
+  /**
+   * Get the event that is triggered when a load into the shadow context has
+   * ended.
+   * @return the event
+   */
+  const sc_core::sc_event &shadow_load_end_event() const {
+    return m_shadow_load_end;
+  }
+
+  /**
+   * Check whether demand configuration is enabled, a.k.a. whether incoming
+   * transactions may trigger the configuration of the module they demand.
+   * @return true if demand configuration is enabled, false otherwise
+   */
+  inline bool is_demand_configuration() const { return m_demand_configuration; }
+
+  /**
+   * Check whether the software fallback is enabled, a.k.a. whether software
+   * models were registered at the reconfiguration region.
+   * @return true if the software fallback is enabled, false otherwise
+   */
+  inline bool is_software_fallback() const { return m_software_fallback; }
+
+  /**
+   * Configure the module that is demanded by the given transaction, unless it
+   * is configured already, and wait until it is load. Must be called from a
+   * thread process.
+   *
+   * @param trans the incoming transaction
+   * @return false if the load of the demanded module was aborted
+   */
+  virtual bool demand_configure(const tlm::tlm_generic_payload &trans) = 0;
+
+  /**
+   * Check without waiting whether the module demanded by the given transaction
+   * can serve it right away. Otherwise, its configuration is started by a
+   * spawned process. Can be called from any process.
+   *
+   * @param trans the incoming transaction
+   * @return true if the transaction can be forwarded to the configured module
+   */
+  virtual bool request_demand_configuration(
+      const tlm::tlm_generic_payload &trans) = 0;
+
  protected:
+  /**
+   * Check that the socket for fetching bitstreams is bound if bitstream fetch
+   * is enabled.
+   */
+  void end_of_elaboration() override;
+
   /// @brief Pointer to the module that the reconfiguration region is contained
   /// in (nullptr => RR on top-level).
   abstract_module_base* m_base_module;
 
  private:
+  /**
+   * Backward path of config_isock. Bitstreams are only fetched by blocking
+   * transactions, so there is nothing to do.
+   */
+  struct config_bw_transport : public tlm::tlm_bw_transport_if<> {
+    tlm::tlm_sync_enum nb_transport_bw(tlm::tlm_generic_payload &trans,
+                                       tlm::tlm_phase &phase,
+                                       sc_core::sc_time &t) override {
+      return tlm::TLM_COMPLETED;
+    }
+
+    void invalidate_direct_mem_ptr(sc_dt::uint64 start_range,
+                                   sc_dt::uint64 end_range) override {}
+  };
+
+  /// @brief The socket through which bitstreams are fetched from a
+  /// configuration memory, nullptr unless bitstream fetch is enabled.
+  std::unique_ptr<config_socket_type> m_config_isock;
+  /// @brief Backward path of config_isock.
+  config_bw_transport m_config_bw;
+  /// @brief Number of bytes per fetched burst, 0 if bitstreams are not
+  /// fetched.
+  size_t m_fetch_burst_bytes = 0;
+  /// @brief Flag indicating whether the bitstream of a module is written.
+  bool m_loading = false;
+  /// @brief Flag indicating whether the current load shall be aborted.
+  bool m_abort_requested = false;
+  /// @brief Fraction of the bitstream written by the current or last load.
+  double m_load_progress = 0;
+  /// @brief Event that is triggered when a load progressed.
+  sc_core::sc_event m_load_progress_event;
+  /// @brief Event that is triggered when the current load shall be aborted.
+  sc_core::sc_event m_abort;
   /// @brief Flag indicating whether there is a reconfiguration in progress.
   bool m_reconfiguring = false;
+  /// @brief Flag indicating whether a module is loaded into the shadow
+  /// context.
+  bool m_shadow_loading = false;
+  /// @brief The module configured before the ongoing or last reconfiguration.
+  abstract_module_base *m_reconf_old_module = nullptr;
+  /// @brief The module configured by the ongoing or last reconfiguration.
+  abstract_module_base *m_reconf_new_module = nullptr;
   /// @brief Flag indicating whether transactions are blocked.
   bool m_transactions_blocked = false;
   /// @brief Number of transactions that have been started by the module but did
   /// not end yet (a.k.a. are active).
   size_t m_active_trans_count = 0;
+  /// @brief Flag indicating whether demand configuration is enabled.
+  bool m_demand_configuration = false;
+  /// @brief Flag indicating whether the software fallback is enabled.
+  bool m_software_fallback = false;
+  /// @brief Event that is triggered when a reconfiguration process has
+  /// started.
+  sc_core::sc_event m_reconf_begin;
+  /// @brief Event that is triggered when a module was unloaded.
+  sc_core::sc_event m_unloaded;
+  /// @brief Event that is triggered when a bitstream was loaded completely.
+  sc_core::sc_event m_load_done;
+  /// @brief Event that is triggered when a module was activated.
+  sc_core::sc_event m_module_active;
+  /// @brief Event that is triggered when a reconfiguration process has ended.
+  sc_core::sc_event m_reconf_end;
+  /// @brief Event that is triggered when a load into the shadow context has
+  /// ended.
+  sc_core::sc_event m_shadow_load_end;
+  /// @brief Event that is triggered when the last active transaction ended.
+  sc_core::sc_event m_transactions_done;
+  /// @brief Listeners that are called when a module was configured or
+  /// unloaded.
+  std::vector<module_listener_t> m_module_listeners;
+  /// @brief Listeners that are called when a reconfiguration reached a phase.
+  std::vector<reconf_listener_t> m_reconf_listeners;
 };
 
 #endif  // REGION_ABSTRACT_RECONF_REGION_BASE_H_
@@ -8,13 +8,27 @@
 #define REGION_CONF_MANAGER_H_
 
 #include <sysc/kernel/sc_module.h>
+#include <sysc/kernel/sc_spawn.h>
 
+#include <algorithm>
+#include <any>
+#include <cmath>
+#include <map>
 #include <memory>
+#include <optional>
+#include <sstream>
+#include <string>
 #include <type_traits>
+#include <typeindex>
+#include <utility>
+#include <vector>
 
 #include "modules/abstract_module_base.h"
 #include "modules/split_manager_base.h"
 #include "nc_interface.h"
+#include "region/nc_module_tag.h"
+#include "region/nc_software_model.h"
+#include "region/variant_selection.h"
 
 /**
  * The base class of configuration managers for any interface, which manages the
@@ -42,11 +56,14 @@ class conf_manager_base : public sc_core::sc_module {
   /**
    * Call mark_reconf_begin on the connected reconfiguration region.
    *
+   * @param old_module the module configured before the reconfiguration
+   * @param new_module the module that is configured by the reconfiguration
    * @see abstract_reconf_region_base#mark_reconf_begin
    */
-  void mark_reconf_begin() {
+  void mark_reconf_begin(abstract_module_base *old_module,
+                         abstract_module_base *new_module) {
     sc_assert(m_rr_base_ptr != nullptr && no_base_ptr_err_msg());
-    m_rr_base_ptr->mark_reconf_begin();
+    m_rr_base_ptr->mark_reconf_begin(old_module, new_module);
   }
 
   /**
@@ -99,6 +116,172 @@ class conf_manager_base : public sc_core::sc_module {
     return m_rr_base_ptr->transactions_blocked();
   }
 
+  /**
+   * Call notify_module_listeners on the connected reconfiguration region.
+   *
+   * @see abstract_reconf_region_base#notify_module_listeners
+   */
+  void notify_module_listeners(abstract_module_base *t, bool configured) {
+    sc_assert(m_rr_base_ptr != nullptr && no_base_ptr_err_msg());
+    m_rr_base_ptr->notify_module_listeners(t, configured);
+  }
+
+  /**
+   * Call notify_reconf_phase on the connected reconfiguration region.
+   *
+   * @see abstract_reconf_region_base#notify_reconf_phase
+   */
+  void notify_reconf_phase(abstract_reconf_region_base::reconf_phase phase) {
+    sc_assert(m_rr_base_ptr != nullptr && no_base_ptr_err_msg());
+    m_rr_base_ptr->notify_reconf_phase(phase);
+  }
+
+  /**
+   * Call is_bitstream_fetch on the connected reconfiguration region.
+   *
+   * @see abstract_reconf_region_base#is_bitstream_fetch
+   */
+  bool is_bitstream_fetch() const {
+    sc_assert(m_rr_base_ptr != nullptr && no_base_ptr_err_msg());
+    return m_rr_base_ptr->is_bitstream_fetch();
+  }
+
+  /**
+   * Call fetch_bitstream on the connected reconfiguration region.
+   *
+   * @see abstract_reconf_region_base#fetch_bitstream
+   */
+  bool fetch_bitstream(sc_dt::uint64 address, size_t bytes,
+                       const sc_core::sc_time &port_time) {
+    sc_assert(m_rr_base_ptr != nullptr && no_base_ptr_err_msg());
+    return m_rr_base_ptr->fetch_bitstream(address, bytes, port_time);
+  }
+
+  /**
+   * Call begin_load on the connected reconfiguration region.
+   *
+   * @see abstract_reconf_region_base#begin_load
+   */
+  void begin_load() {
+    sc_assert(m_rr_base_ptr != nullptr && no_base_ptr_err_msg());
+    m_rr_base_ptr->begin_load();
+  }
+
+  /**
+   * Call end_load on the connected reconfiguration region.
+   *
+   * @see abstract_reconf_region_base#end_load
+   */
+  void end_load() {
+    sc_assert(m_rr_base_ptr != nullptr && no_base_ptr_err_msg());
+    m_rr_base_ptr->end_load();
+  }
+
+  /**
+   * Call wait_load on the connected reconfiguration region.
+   *
+   * @see abstract_reconf_region_base#wait_load
+   */
+  bool wait_load(const sc_core::sc_time &t) {
+    sc_assert(m_rr_base_ptr != nullptr && no_base_ptr_err_msg());
+    return m_rr_base_ptr->wait_load(t);
+  }
+
+  /**
+   * Call set_load_progress on the connected reconfiguration region.
+   *
+   * @see abstract_reconf_region_base#set_load_progress
+   */
+  void set_load_progress(double progress) {
+    sc_assert(m_rr_base_ptr != nullptr && no_base_ptr_err_msg());
+    m_rr_base_ptr->set_load_progress(progress);
+  }
+
+  /**
+   * Call set_software_fallback on the connected reconfiguration region.
+   *
+   * @see abstract_reconf_region_base#set_software_fallback
+   */
+  void set_software_fallback(bool enable) {
+    sc_assert(m_rr_base_ptr != nullptr && no_base_ptr_err_msg());
+    m_rr_base_ptr->set_software_fallback(enable);
+  }
+
+  /**
+   * Call has_active_transactions on the connected reconfiguration region.
+   *
+   * @see abstract_reconf_region_base#has_active_transactions
+   */
+  bool has_active_transactions() {
+    sc_assert(m_rr_base_ptr != nullptr && no_base_ptr_err_msg());
+    return m_rr_base_ptr->has_active_transactions();
+  }
+
+  /**
+   * Wait until the currently ongoing reconfiguration process of the connected
+   * reconfiguration region has ended.
+   *
+   * @see abstract_reconf_region_base#reconf_end_event
+   */
+  void wait_reconf_end() {
+    sc_assert(m_rr_base_ptr != nullptr && no_base_ptr_err_msg());
+    sc_core::wait(m_rr_base_ptr->reconf_end_event());
+  }
+
+  /**
+   * Call mark_shadow_load_begin on the connected reconfiguration region.
+   *
+   * @see abstract_reconf_region_base#mark_shadow_load_begin
+   */
+  void mark_shadow_load_begin() {
+    sc_assert(m_rr_base_ptr != nullptr && no_base_ptr_err_msg());
+    m_rr_base_ptr->mark_shadow_load_begin();
+  }
+
+  /**
+   * Call mark_shadow_load_end on the connected reconfiguration region.
+   *
+   * @see abstract_reconf_region_base#mark_shadow_load_end
+   */
+  void mark_shadow_load_end() {
+    sc_assert(m_rr_base_ptr != nullptr && no_base_ptr_err_msg());
+    m_rr_base_ptr->mark_shadow_load_end();
+  }
+
+  /**
+   * Wait until a load into the shadow context of the connected
+   * reconfiguration region has ended, if there is one.
+   *
+   * @see abstract_reconf_region_base#shadow_load_end_event
+   */
+  void wait_shadow_load() {
+    sc_assert(m_rr_base_ptr != nullptr && no_base_ptr_err_msg());
+    while (m_rr_base_ptr->is_shadow_loading()) {
+      sc_core::wait(m_rr_base_ptr->shadow_load_end_event());
+    }
+  }
+
+  /**
+   * Wait until the transactions in progress at the connected reconfiguration
+   * region have ended.
+   *
+   * @see abstract_reconf_region_base#transactions_done_event
+   */
+  void wait_transactions_done() {
+    sc_assert(m_rr_base_ptr != nullptr && no_base_ptr_err_msg());
+    sc_core::wait(m_rr_base_ptr->transactions_done_event());
+  }
+
+  /**
+   * Call set_demand_configuration on the connected reconfiguration region.
+   *
+   * @see abstract_reconf_region_base#set_demand_configuration
+   */
+  void set_demand_configuration(bool enable) {
+    sc_assert(m_rr_base_ptr != nullptr && no_base_ptr_err_msg());
+    m_rr_base_ptr->set_demand_configuration(enable);
+  }
+
   /**
    * Call check_unload_ok on the connected reconfiguration region.
    *
@@ -121,6 +304,24 @@ class conf_manager_base : public sc_core::sc_module {
     t->nc_couple(m_rr_base_ptr, sync);
   }
 
+  /**
+   * Statically bind the adapters of the given module.
+   *
+   * @param t the module whose adapters shall be bound
+   */
+  static void bind_module(abstract_module_base *t) { t->nc_bind_adapters(); }
+
+  /**
+   * Bind the module's members directly to those of the connected
+   * reconfiguration region.
+   *
+   * @param t the module to freeze
+   */
+  void freeze_module(abstract_module_base *t) {
+    sc_assert(m_rr_base_ptr != nullptr && no_base_ptr_err_msg());
+    t->nc_freeze(m_rr_base_ptr);
+  }
+
   /**
    * Activate the given module by spawning its processes.
    *
@@ -135,6 +336,96 @@ class conf_manager_base : public sc_core::sc_module {
    */
   static void deactivate_module(abstract_module_base *t) { t->nc_deactivate(); }
 
+  /**
+   * Quiesce the modules of the regions nested within the given module.
+   *
+   * @param t the module that is about to be unloaded
+   */
+  static void quiesce_nested_regions(abstract_module_base *t) {
+    t->nc_quiesce_nested_regions();
+  }
+
+  /**
+   * Tell the given module that it is about to be unloaded.
+   *
+   * @param t the module that is about to be unloaded
+   * @return true if the module is ready to be unloaded right away
+   */
+  static bool notify_reconf_imminent(abstract_module_base *t) {
+    return t->nc_notify_reconf_imminent();
+  }
+
+  /**
+   * Wait until the given module acknowledged that it is about to be unloaded.
+   *
+   * @param t the module that is about to be unloaded
+   * @param timeout the maximum time to wait, SC_ZERO_TIME for no limit
+   * @return false if the timeout expired
+   */
+  static bool wait_reconf_ack(abstract_module_base *t,
+                              const sc_core::sc_time &timeout) {
+    return t->nc_wait_reconf_ack(timeout);
+  }
+
+  /**
+   * Take the state that the given module handed off during its deactivation.
+   *
+   * @param t the deactivated module
+   * @param size_bytes set to the size of the state in byte
+   * @return the state, which is empty if none was handed off
+   */
+  static std::any take_handoff_state(abstract_module_base *t,
+                                     size_t &size_bytes) {
+    return t->nc_take_handoff_state(size_bytes);
+  }
+
+  /**
+   * Give the given module the state handed off by the previous module, before
+   * it is activated.
+   *
+   * @param t the module to activate
+   * @param state the handed off state
+   */
+  static void give_handoff_state(abstract_module_base *t, std::any state) {
+    t->nc_give_handoff_state(std::move(state));
+  }
+
+  /**
+   * Save the context of the given module before it is deactivated.
+   *
+   * @param t the module whose context shall be saved
+   */
+  static void save_context(abstract_module_base *t) { t->nc_save_context(); }
+
+  /**
+   * Restore the saved context of the given module after it was activated.
+   *
+   * @param t the module whose context shall be restored
+   */
+  static void restore_context(abstract_module_base *t) {
+    t->nc_restore_context();
+  }
+
+  /**
+   * Discard the saved context of the given module, which was activated without
+   * restoring it.
+   *
+   * @param t the module whose context shall be discarded
+   */
+  static void discard_context(abstract_module_base *t) {
+    t->nc_discard_context();
+  }
+
+  /**
+   * Check whether the given module has a saved context.
+   *
+   * @param t the module to check
+   * @return true if there is a saved context, false otherwise
+   */
+  static bool has_saved_context(const abstract_module_base *t) {
+    return t->nc_has_saved_context();
+  }
+
   /**
    * Decouple the module's members from those of the connected reconfiguration
    * region.
@@ -207,6 +498,7 @@ template <class Interface,
 class conf_manager : public conf_manager_base {
   typedef conf_manager this_type;
   typedef conf_manager_base base_type;
+  typedef abstract_reconf_region_base::reconf_phase reconf_phase;
 
  public:
   typedef typename Interface::configurable_base configurable_base_type;
@@ -245,9 +537,9 @@ class conf_manager : public conf_manager_base {
    */
   template <typename Module, typename... Args>
   void do_register_module(Args... args) {
-    if (sc_core::sc_is_running()) {
+    if (sc_core::sc_is_running() || m_modules_bound) {
       SC_REPORT_ERROR(this->name(),
-                      "Cannot register module during simulation time.");
+                      "Cannot register module after elaboration.");
     }
 
     if (find_module<Module>() != nullptr) {
@@ -263,13 +555,17 @@ class conf_manager : public conf_manager_base {
    * is ongoing and transactions are already blocked. First the members of the
    * module are coupled with those of the reconfiguration region and if the
    * passed parameter is true, the adapters are synchronized. Afterwards,
-   * transactions are unblocked, and the module is activated.
+   * transactions are unblocked, and the module is activated. Its saved
+   * context is restored right after the activation, before the module is
+   * reported as configured. Unless it shall be restored, a saved context is
+   * discarded, since the module starts over without it.
    *
    * @param do_sync if true, adapters of the module and reconfiguration region
    * will synchronize
+   * @param restore if true, the saved context of the module is restored
    * @note the reconfiguration-active flag is reset by this function
    */
-  void load_current_module(bool do_sync = true) {
+  void load_current_module(bool do_sync = true, bool restore = false) {
     sc_assert(
         m_current_module != nullptr &&
         "Load current module called when no module was set as current module.");
@@ -278,13 +574,22 @@ class conf_manager : public conf_manager_base {
     sc_assert(transactions_blocked() &&
               "Can only load module when transactions are blocked.");
 
-    // couple first
-    couple_module(m_current_module.get(), do_sync);
+    // couple first, a frozen module is bound statically instead
+    if (m_current_module != m_frozen_module) {
+      couple_module(m_current_module.get(), do_sync);
+    }
 
     // then unblock before we activate
     unblock_transactions();
 
     activate_module(m_current_module.get());
+    if (restore) {
+      restore_context(m_current_module.get());
+    } else {
+      discard_context(m_current_module.get());
+    }
+    notify_module_listeners(m_current_module.get(), true);
+    notify_reconf_phase(reconf_phase::module_active);
 
     mark_reconf_end();
   }
@@ -301,8 +606,14 @@ class conf_manager : public conf_manager_base {
   void unload_module_unprotected() override {
     if (m_current_module) {
       check_unload_ok();
-      decouple_module(m_current_module.get());
+      // a frozen module is bound statically, so there is nothing to decouple
+      if (m_current_module != m_frozen_module) {
+        decouple_module(m_current_module.get());
+      }
       deactivate_module(m_current_module.get());
+      notify_module_listeners(m_current_module.get(), false);
+      // nested regions are also cleared outside of their reconfigurations
+      if (is_reconfiguring()) notify_reconf_phase(reconf_phase::unloaded);
       NC_REPORT_CONDITIONAL(name(),
                             "module " << m_current_module->name() << " unload")
       m_current_module = nullptr;
@@ -314,145 +625,1130 @@ class conf_manager : public conf_manager_base {
     return sc_core::sc_gen_unique_name("conf_manager");
   }
 
- public:
   /**
-   * Create a new configuration manager given its name.
-   * If no name is specified, the module will receive its default name.
+   * Configure the given registered module, which is not configured yet. If
+   * another module is already load then it will be tried to unload it using
+   * unload_module_unprotected. The new module is load using
+   * load_current_module. Inbetween, there is a delay so that the
+   * reconfiguration time can pass.
+   * On a context switch, the context of the unloaded module is saved before it
+   * is deactivated, and the saved context of the new module is restored after
+   * it was activated. The transfer of both contexts adds to the delay, as does
+   * the transfer of a state that the unloaded module handed off to the new
+   * one.
+   * If the load is aborted while the bitstream is written, the region is left
+   * empty, and a state handed off by the unloaded module is lost. An ongoing
+   * load into the shadow context is waited for first, and a module that waits
+   * in the shadow context is swapped in instead of being loaded a second time.
    *
-   * @param name the name of the module or default name if none is provided
-   * @see conf_manager#default_name
+   * @param t the module to configure
+   * @param switch_context if true, save and restore the modules' contexts
+   * @return false if the load was aborted
+   * @see conf_manager#get_delta_load_time, conf_manager#get_context_time,
+   * abstract_reconf_region_base#abort_configuration
    */
-  explicit conf_manager(sc_core::sc_module_name name = default_name())
-      : conf_manager_base(name) {}
+  bool configure(const module_ptr_t &t, bool switch_context = false) {
+    wait_shadow_load();
+
+    // a module that waits in the shadow context is swapped in right away
+    if (t == m_shadow_module) {
+      swap_in_shadow_module(switch_context);
+      return true;
+    }
+
+    sc_core::sc_time context_time = sc_core::SC_ZERO_TIME;
+    module_ptr_t previous =
+        begin_module_switch(t, switch_context, context_time);
+    m_current_module = t;
+
+    if (!load_bitstream()) {
+      drop_handoff_state(previous);
+      return false;
+    }
+    finish_module_switch(previous, switch_context, context_time);
+    return true;
+  }
 
   /**
-   * Wrapper function using type traits to ensure that the module has the
-   * necessary members of the correct interface. Actual registration is done by
-   * do_register_module.
+   * Start a reconfiguration to the given module by quiescing, blocking and
+   * unloading the configured module. On a context switch, the context of the
+   * configured module is saved before it is deactivated.
    *
-   * @tparam Module the type of the module to register
-   * @tparam Args types of optional arguments for the module construction
-   * @param args optional arguments which may be needed to construct the module
-   * @see conf_manager#do_register_module
+   * @param t the module to configure
+   * @param switch_context if true, save the context of the configured module
+   * @param context_time set to the time needed to save the context
+   * @return the unloaded module, nullptr if the region was empty
+   * @see conf_manager#finish_module_switch
    */
-  template <typename Module,
-            typename = std::enable_if_t<
-                std::is_base_of<module_base_type, Module>::value>,
-            typename... Args>
-  void register_module(Args... args) {
-    do_register_module<Module>(args...);
+  module_ptr_t begin_module_switch(const module_ptr_t &t, bool switch_context,
+                                   sc_core::sc_time &context_time) {
+    mark_reconf_begin(m_current_module.get(), t.get());
+    quiesce_current_module();
+    block_transactions();
+
+    if (switch_context && m_current_module != nullptr) {
+      save_context(m_current_module.get());
+      context_time += get_context_time(m_current_module);
+    }
+
+    module_ptr_t previous = m_current_module;
+    unload_module_unprotected();
+    return previous;
   }
 
   /**
-   * Wrapper function using type traits to ensure that the split manager has no
-   * members from the interface. Actual registration procedure does not differ
-   * from the one of a module and is done by do_register_module.
+   * Finish a reconfiguration started by begin_module_switch, once the new
+   * module is the current one and its bitstream is load. Only then, the state
+   * that the unloaded module handed off during its deactivation is taken, so
+   * that an aborted load does not destroy it unnoticed. The saved context of
+   * the new module and the handed off state are transferred before the module
+   * is coupled and activated.
    *
-   * @tparam SplitMngr type of the split manager
+   * @param previous the unloaded module, nullptr if the region was empty
+   * @param switch_context if true, restore the context of the new module
+   * @param context_time the time needed to save the context of the unloaded
+   * module
+   * @see conf_manager#begin_module_switch
    */
-  template <typename SplitMngr, typename = std::enable_if_t<std::is_base_of<
-                                    configurable_base_type, SplitMngr>::value>>
-  void register_split() {
-    do_register_module<SplitMngr>();
+  void finish_module_switch(const module_ptr_t &previous, bool switch_context,
+                            sc_core::sc_time context_time) {
+    if (switch_context && has_saved_context(m_current_module.get())) {
+      context_time += get_context_time(m_current_module);
+    }
+
+    size_t handoff_bytes = 0;
+    std::any handoff_state;
+    if (previous != nullptr) {
+      handoff_state = take_handoff_state(previous.get(), handoff_bytes);
+    }
+    sc_core::sc_time handoff_time = handoff_state.has_value()
+                                        ? get_transfer_time(handoff_bytes)
+                                        : sc_core::SC_ZERO_TIME;
+    context_time += handoff_time;
+    if (context_time > sc_core::SC_ZERO_TIME) sc_core::wait(context_time);
+
+    if (handoff_state.has_value()) {
+      give_handoff_state(m_current_module.get(), std::move(handoff_state));
+      m_handoff_time += handoff_time;
+      m_handoff_bytes += handoff_bytes;
+    }
+    load_current_module(true, switch_context);
   }
 
   /**
-   * Register a module for preloading so that it will be already load on
-   * simulation start or when the module that contains the reconfiguration
-   * region is activated. Only modules that have been previously registered can
-   * be preload. If already one module for preloading was registered when this
-   * function is called, the with this call specified module takes its place.
+   * Drop the state that the given unloaded module handed off, since the load
+   * of the module that should have taken it was aborted. The loss is reported
+   * and counted.
    *
-   * @tparam Module the type of the module that shall be preload
+   * @param previous the unloaded module, nullptr if the region was empty
+   * @see conf_manager#get_lost_handoff_count
    */
-  NC_INTERNAL_TMPL_BASE_OF(Module, typename Interface::module_base)
-  void preload_module() {
-    auto t = find_module<Module>();
-    if (t == nullptr) {
-      SC_REPORT_ERROR(name(), "Cannot preload module that is not registered.");
+  void drop_handoff_state(const module_ptr_t &previous) {
+    if (previous == nullptr) return;
+
+    size_t handoff_bytes = 0;
+    if (take_handoff_state(previous.get(), handoff_bytes).has_value()) {
+      NC_REPORT_CONDITIONAL(name(), "State handed off by module "
+                                        << previous->name()
+                                        << " was lost, since the load was "
+                                           "aborted")
+      m_lost_handoffs++;
     }
+  }
 
-    m_preload_module = t;
+  /**
+   * Tell the configured module that it is about to be unloaded and wait until
+   * it acknowledged or the quiescence timeout expired. Afterwards, the modules
+   * of regions nested in it are quiesced the same way, since they are unloaded
+   * together with it. Transactions are not blocked meanwhile, so that the
+   * modules can finish their work in flight.
+   *
+   * @see abstract_module_base#on_reconf_imminent
+   */
+  void quiesce_current_module() {
+    if (m_current_module == nullptr) return;
+
+    sc_core::sc_time start = sc_core::sc_time_stamp();
+    if (!notify_reconf_imminent(m_current_module.get()) &&
+        !wait_reconf_ack(m_current_module.get(), m_quiescence_timeout)) {
+      NC_REPORT_CONDITIONAL(name(), "Module " << m_current_module->name()
+                                              << " did not acknowledge the "
+                                                 "reconfiguration in time")
+      m_quiescence_timeouts++;
+    }
+    quiesce_nested_regions(m_current_module.get());
+    m_quiescence_time += sc_core::sc_time_stamp() - start;
   }
 
   /**
-   * Actually load a module that was registered for preloading earlier.
-   * This function will mark a reconfiguration begin and block transactions, set
-   * the preloaded module as current module. Afterwards, load_current_module is
-   * called, which actually loads the module, unblocks transactions and marks
-   * the end of the reconfiguration process. If the passed parameter is true
-   * (default), the functions assumes that the module is preloaded in a nested
-   * reconfiguration region adn the adapters of it will get synchronized.
-   * If not module specified for preloading this function will do nothing.
+   * Load the bitstream of the module that is being configured into the
+   * region, which is blocked already. If the load is aborted, the region is
+   * left empty.
    *
-   * @param nested_preload if true (default), the adapters of the module will
-   * get synchronized during load
-   * @see conf_manager#load_current_module
+   * @return false if the load was aborted
    */
-  void perform_preload(bool nested_preload = true) {
-    // return if no preload module was registered
-    if (m_preload_module == nullptr) return;
+  bool load_bitstream() {
+    size_t load_bytes = get_load_bytes(m_current_module);
+    sc_core::sc_time load_time = get_write_time(m_current_module, load_bytes);
 
-    // start like normal reconfiguration, but no wait
-    mark_reconf_begin();
-    block_transactions();
+    NC_REPORT_CONDITIONAL(name(), "Reconfiguring module "
+                                      << m_current_module->name()
+                                      << ", load time [us]:"
+                                      << load_time.to_seconds() * 1e6)
+    sc_assert(load_time > sc_core::SC_ZERO_TIME &&
+              "Reconfiguration has to be larger that zero.");
 
-    m_current_module = m_preload_module;
+    // the actual load time depends on the traffic at the memory and aborts
+    sc_core::sc_time start = sc_core::sc_time_stamp();
+    begin_load();
+    bool loaded =
+        is_bitstream_fetch()
+            ? fetch_bitstream(
+                  get_bitstream_address(m_current_module),
+                  get_transferred_bytes(m_current_module, load_bytes),
+                  load_time)
+            : write_bitstream(load_bytes, load_time);
+    end_load();
+    m_total_load_time += sc_core::sc_time_stamp() - start;
 
-    // only sync nested preloads
-    load_current_module(nested_preload);
+    if (!loaded) {
+      abort_load();
+      return false;
+    }
+
+    write_frames(m_current_module);
+    m_loaded_bytes += load_bytes;
+    notify_reconf_phase(reconf_phase::load_done);
+    return true;
   }
 
   /**
-   * Configure a module during the simulation time. Only registered modules can
-   * be configured. This function should only be called if no other
-   * reconfiguration request is currently in progress. If another module is
-   * already load then it will be tried to unload it using
-   * unload_module_unprotected. The new module is load using
-   * load_current_module. Inbetween, there is a delay so that the
-   * reconfiguration time can pass. This is calculated from the reconfiguration
-   * speed of the interface and the modules size.
+   * Write the bitstream of the module that is being configured in chunks of
+   * one frame, or in one chunk if the region has no frame model. The load
+   * progress is updated after every chunk.
    *
-   * @tparam Module the type of the module to configure
-   * @see conf_manager#unload_module_unprotected,
-   * conf_manager#load_current_module,
-   * abstract_module_base#get_bitstream_size_bytes
+   * @param bytes the number of bytes to write
+   * @param load_time the time needed to write all bytes
+   * @return false if the load was aborted
    */
-  NC_INTERNAL_TMPL_BASE_OF(Module, configurable_base_type)
-  void configure_module() {
-    auto t = find_module<Module>();
-    if (t == nullptr) {
-      SC_REPORT_ERROR(name(),
-                      "Cannot configure module that is not registered.");
-      return;
+  bool write_bitstream(size_t bytes, const sc_core::sc_time &load_time) {
+    size_t chunk = m_frames.empty() ? bytes : m_frame_size_bytes;
+    sc_core::sc_time start = sc_core::sc_time_stamp();
+
+    for (size_t written = 0; written < bytes;) {
+      written = std::min(written + chunk, bytes);
+      // relative to the start, so that the chunks add up to the load time
+      double progress = static_cast<double>(written) / bytes;
+      sc_core::sc_time end = start + load_time * progress;
+      if (!wait_load(end - sc_core::sc_time_stamp())) return false;
+      set_load_progress(progress);
+    }
+    return true;
+  }
+
+  /**
+   * Make the module in the shadow context the configured one, and keep the
+   * previously configured module in the now inactive context. Both contexts
+   * are loaded already, so the old module is decoupled and the new one coupled
+   * within the same delta cycle, unless a context switch or a state handed off
+   * by the old module needs to be transferred first.
+   *
+   * @param switch_context if true, save and restore the modules' contexts
+   */
+  void swap_in_shadow_module(bool switch_context = false) {
+    sc_core::sc_time context_time = sc_core::SC_ZERO_TIME;
+    module_ptr_t previous =
+        begin_module_switch(m_shadow_module, switch_context, context_time);
+
+    m_current_module = m_shadow_module;
+    m_shadow_module = previous;
+    std::swap(m_frames, m_shadow_frames);
+    m_swaps++;
+    NC_REPORT_CONDITIONAL(name(), "Swapped in module "
+                                      << m_current_module->name())
+
+    finish_module_switch(previous, switch_context, context_time);
+  }
+
+  /**
+   * Leave the region empty after the load of the current module was aborted.
+   * The module was neither coupled nor activated, and the frames of the region
+   * were partly overwritten.
+   */
+  void abort_load() {
+    NC_REPORT_CONDITIONAL(name(), "Aborted loading module "
+                                      << m_current_module->name())
+    m_current_module = nullptr;
+    std::fill(m_frames.begin(), m_frames.end(), std::nullopt);
+
+    unblock_transactions();
+    mark_reconf_end();
+  }
+
+  /**
+   * Get the time needed to transfer the given number of bytes at the
+   * reconfiguration speed of the interface.
+   *
+   * @param bytes the number of bytes
+   * @return the transfer time
+   */
+  static sc_core::sc_time get_transfer_time(size_t bytes) {
+    // size in Byte, load speed in MByte -> * 1/1e6, convert second to us
+    // -> * 1e6 => no conversion
+    return sc_core::sc_time(bytes / Interface::load_speed_MBps,
+                            sc_core::SC_US);
+  }
+
+  /**
+   * Get the number of bytes that need to be written to load the given module
+   * into the region. With a frame model and frame signatures of the module,
+   * only the frames that differ from those currently in the region are
+   * written, but at least one. Otherwise, the whole bitstream is written.
+   *
+   * @param t the module to load
+   * @return the number of bytes to write
+   */
+  size_t get_load_bytes(const module_ptr_t &t) const {
+    std::vector<size_t> signatures = t->get_frame_signatures();
+    if (m_frames.empty() || signatures.empty()) {
+      return t->get_bitstream_size_bytes();
+    }
+    sc_assert(signatures.size() <= m_frames.size() &&
+              "Module has more frames than the region.");
+
+    size_t frames = 0;
+    for (size_t i = 0; i < signatures.size(); i++) {
+      if (m_frames[i] != signatures[i]) frames++;
+    }
+    return std::max<size_t>(frames, 1) * m_frame_size_bytes;
+  }
+
+  /**
+   * Get the time needed to write the given number of bytes of a module's
+   * bitstream into the region. If the region's decompressor supports the
+   * module's compression scheme, the compressed bytes are transferred and
+   * decompressed in a pipeline, so the slower of both determines the time.
+   * Otherwise, the bytes are transferred uncompressed.
+   *
+   * @param t the module to write
+   * @param bytes the number of uncompressed bytes to write
+   * @return the write time
+   */
+  sc_core::sc_time get_write_time(const module_ptr_t &t, size_t bytes) const {
+    sc_core::sc_time transfer_time =
+        get_transfer_time(get_transferred_bytes(t, bytes));
+    if (!is_decompressed(t)) return transfer_time;
+
+    sc_core::sc_time decompression_time(bytes / m_decompressor_MBps,
+                                        sc_core::SC_US);
+    return std::max(transfer_time, decompression_time);
+  }
+
+  /**
+   * Check whether the bitstream of the given module is transferred compressed
+   * and decompressed by the region's decompressor.
+   *
+   * @param t the module
+   * @return true if the region's decompressor supports the module's bitstream
+   */
+  bool is_decompressed(const module_ptr_t &t) const {
+    return m_decompressor_MBps > 0 &&
+           t->get_compressed_bitstream_size_bytes() != 0 &&
+           t->get_compression_scheme() == m_decompressor_scheme;
+  }
+
+  /**
+   * Get the number of bytes that are transferred to write the given number of
+   * bytes of a module's bitstream, which are fewer if the bitstream is
+   * decompressed by the region.
+   *
+   * @param t the module to write
+   * @param bytes the number of uncompressed bytes to write
+   * @return the number of transferred bytes
+   */
+  size_t get_transferred_bytes(const module_ptr_t &t, size_t bytes) const {
+    if (!is_decompressed(t)) return bytes;
+
+    // a partial bitstream is assumed to compress like the whole one
+    double compressed_bytes = static_cast<double>(bytes) *
+                              t->get_compressed_bitstream_size_bytes() /
+                              t->get_bitstream_size_bytes();
+    return static_cast<size_t>(std::ceil(compressed_bytes));
+  }
+
+  /**
+   * Get the address of the given module's bitstream in the configuration
+   * memory.
+   *
+   * @param t the module
+   * @return the address or 0 if none was set
+   */
+  sc_dt::uint64 get_bitstream_address(const module_ptr_t &t) const {
+    auto it = m_bitstream_addresses.find(t.get());
+    if (it == m_bitstream_addresses.end()) {
+      SC_REPORT_ERROR(name(), "Cannot fetch bitstream without address.");
+      return 0;
+    }
+    return it->second;
+  }
+
+  /**
+   * Update the frames that are in the region after the given module was
+   * written. The frames of a module without signatures become unknown.
+   *
+   * @param t the module that was written
+   */
+  void write_frames(const module_ptr_t &t) {
+    std::vector<size_t> signatures = t->get_frame_signatures();
+    if (signatures.empty()) {
+      std::fill(m_frames.begin(), m_frames.end(), std::nullopt);
+      return;
+    }
+    for (size_t i = 0; i < signatures.size() && i < m_frames.size(); i++) {
+      m_frames[i] = signatures[i];
+    }
+  }
+
+  /**
+   * Configure the given demanded module, unless it is configured already, and
+   * wait until it is load. A load into the shadow context is only waited for if
+   * the demanded module is not configured.
+   *
+   * @param t the demanded module
+   * @return false if the load of the demanded module was aborted
+   */
+  bool demand_configure_module(const module_ptr_t &t) {
+    while (t != m_current_module || is_reconfiguring()) {
+      if (is_reconfiguring()) {
+        wait_reconf_end();
+      } else if (has_active_transactions()) {
+        wait_transactions_done();
+      } else {
+        NC_REPORT_CONDITIONAL(name(), "Demand miss for module " << t->name())
+        m_demand_misses++;
+        if (!configure(t)) {
+          NC_REPORT_CONDITIONAL(name(), "Demanded load of module "
+                                            << t->name() << " was aborted")
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
+  /**
+   * Find the registered module that is demanded by the given transaction,
+   * either by its nc_module_tag or by the registered address ranges. The tag
+   * takes precedence.
+   *
+   * @param trans the transaction
+   * @return the demanded module or nullptr if the transaction demands none
+   */
+  module_ptr_t find_demanded_module(const tlm::tlm_generic_payload &trans) {
+    auto tag = trans.get_extension<nc_module_tag>();
+    if (tag != nullptr) {
+      for (const auto &t : m_modules) {
+        if (std::type_index(typeid(*t)) == tag->get_module_type()) return t;
+      }
+      SC_REPORT_ERROR(name(), "Transaction demands unregistered module.");
+      return nullptr;
+    }
+
+    sc_dt::uint64 address = trans.get_address();
+    for (const auto &range : m_demand_ranges) {
+      if (address >= range.start && address <= range.end) return range.module;
+    }
+    return nullptr;
+  }
+
+  /**
+   * Find the software model for the module that is demanded by the given
+   * transaction or, if it demands none, for the currently configured module.
+   *
+   * @param trans the transaction
+   * @return the software model or nullptr if there is none
+   */
+  nc_software_model *find_software_model(
+      const tlm::tlm_generic_payload &trans) {
+    module_ptr_t t = find_demanded_module(trans);
+    if (t == nullptr) t = m_current_module;
+    if (t == nullptr) return nullptr;
+
+    auto it = m_software_models.find(t.get());
+    return it != m_software_models.end() ? it->second.get() : nullptr;
+  }
+
+  /**
+   * Report an error if a module is frozen at the reconfiguration region, since
+   * the frozen module can never be replaced or unloaded.
+   *
+   * @param action description of the requested action used in the report
+   */
+  void check_not_frozen(const char *action) const {
+    if (m_frozen_module != nullptr) {
+      std::stringstream ss;
+      ss << "Cannot " << action << ", since module "
+         << m_frozen_module->name() << " is frozen at the region.";
+      SC_REPORT_ERROR(name(), ss.str().c_str());
+    }
+  }
+
+ protected:
+  /**
+   * Statically bind the adapters of all registered modules except the frozen
+   * one, whose members are bound directly to those of the reconfiguration
+   * region instead.
+   */
+  void before_end_of_elaboration() override {
+    for (const auto &t : m_modules) {
+      if (t == m_frozen_module) {
+        freeze_module(t.get());
+      } else {
+        bind_module(t.get());
+      }
+    }
+    m_modules_bound = true;
+  }
+
+ public:
+  /**
+   * Create a new configuration manager given its name.
+   * If no name is specified, the module will receive its default name.
+   *
+   * @param name the name of the module or default name if none is provided
+   * @see conf_manager#default_name
+   */
+  explicit conf_manager(sc_core::sc_module_name name = default_name())
+      : conf_manager_base(name) {}
+
+  /**
+   * Wrapper function using type traits to ensure that the module has the
+   * necessary members of the correct interface. Actual registration is done by
+   * do_register_module.
+   *
+   * @tparam Module the type of the module to register
+   * @tparam Args types of optional arguments for the module construction
+   * @param args optional arguments which may be needed to construct the module
+   * @see conf_manager#do_register_module
+   */
+  template <typename Module,
+            typename = std::enable_if_t<
+                std::is_base_of<module_base_type, Module>::value>,
+            typename... Args>
+  void register_module(Args... args) {
+    do_register_module<Module>(args...);
+  }
+
+  /**
+   * Wrapper function using type traits to ensure that the split manager has no
+   * members from the interface. Actual registration procedure does not differ
+   * from the one of a module and is done by do_register_module.
+   *
+   * @tparam SplitMngr type of the split manager
+   */
+  template <typename SplitMngr, typename = std::enable_if_t<std::is_base_of<
+                                    configurable_base_type, SplitMngr>::value>>
+  void register_split() {
+    do_register_module<SplitMngr>();
+  }
+
+  /**
+   * Register a module for preloading so that it will be already load on
+   * simulation start or when the module that contains the reconfiguration
+   * region is activated. Only modules that have been previously registered can
+   * be preload. If already one module for preloading was registered when this
+   * function is called, the with this call specified module takes its place.
+   *
+   * @tparam Module the type of the module that shall be preload
+   */
+  NC_INTERNAL_TMPL_BASE_OF(Module, typename Interface::module_base)
+  void preload_module() {
+    check_not_frozen("preload another module");
+
+    auto t = find_module<Module>();
+    if (t == nullptr) {
+      SC_REPORT_ERROR(name(), "Cannot preload module that is not registered.");
+    }
+
+    m_preload_module = t;
+  }
+
+  /**
+   * Freeze a registered module at the reconfiguration region. Instead of
+   * coupling adapters, the members of the module are bound directly to those
+   * of the reconfiguration region before the end of elaboration, so that they
+   * interact without any adapter, signal relay or reconfiguration lock in
+   * between. The module is preloaded like any other module, but it can never be
+   * replaced or unloaded afterwards. Thus, this can only be done during
+   * elaboration and only once. In a nested region, the frozen module is still
+   * unloaded and loaded again together with the module that contains the
+   * region.
+   *
+   * @tparam Module the type of the module that shall be frozen
+   */
+  NC_INTERNAL_TMPL_BASE_OF(Module, typename Interface::module_base)
+  void freeze() {
+    if (m_modules_bound) {
+      SC_REPORT_ERROR(name(),
+                      "Cannot freeze module after the adapters were bound.");
+    }
+    check_not_frozen("freeze another module");
+
+    auto t = find_module<Module>();
+    if (t == nullptr) {
+      SC_REPORT_ERROR(name(), "Cannot freeze module that is not registered.");
+    }
+
+    m_frozen_module = t;
+    m_preload_module = t;
+  }
+
+  /**
+   * Check whether a module is frozen at the reconfiguration region.
+   *
+   * @return true if a module is frozen, false otherwise
+   */
+  bool is_frozen() const { return m_frozen_module != nullptr; }
+
+  /**
+   * Actually load a module that was registered for preloading earlier.
+   * This function will mark a reconfiguration begin and block transactions, set
+   * the preloaded module as current module. Afterwards, load_current_module is
+   * called, which actually loads the module, unblocks transactions and marks
+   * the end of the reconfiguration process. The adapters of the module are
+   * synchronized unless the passed parameter is false. This is also possible
+   * for preloads before the simulation starts, since the adapters hand the
+   * current values to the module without waiting.
+   * If not module specified for preloading this function will do nothing.
+   *
+   * @param sync if true (default), the adapters of the module will get
+   * synchronized during load
+   * @see conf_manager#load_current_module
+   */
+  void perform_preload(bool sync = true) {
+    // return if no preload module was registered
+    if (m_preload_module == nullptr) return;
+
+    // start like normal reconfiguration, but no wait
+    mark_reconf_begin(m_current_module.get(), m_preload_module.get());
+    block_transactions();
+
+    m_current_module = m_preload_module;
+
+    load_current_module(sync);
+  }
+
+  /**
+   * Configure a module during the simulation time. Only registered modules can
+   * be configured. This function should only be called if no other
+   * reconfiguration request is currently in progress. If another module is
+   * already load then it will be tried to unload it using
+   * unload_module_unprotected. The new module is load using
+   * load_current_module. Inbetween, there is a delay so that the
+   * reconfiguration time can pass. This is calculated from the reconfiguration
+   * speed of the interface and the modules size.
+   *
+   * @tparam Module the type of the module to configure
+   * @return true if the module is configured afterwards, false if it is not
+   * registered or its load was aborted
+   * @see conf_manager#unload_module_unprotected,
+   * conf_manager#load_current_module,
+   * abstract_module_base#get_bitstream_size_bytes
+   */
+  NC_INTERNAL_TMPL_BASE_OF(Module, configurable_base_type)
+  bool configure_module() {
+    check_not_frozen("configure a module");
+
+    auto t = find_module<Module>();
+    if (t == nullptr) {
+      SC_REPORT_ERROR(name(),
+                      "Cannot configure module that is not registered.");
+      return false;
     } else if (t == m_current_module) {
       NC_REPORT_CONDITIONAL(
           name(),
           "Tried to configure module that is already configured. Ignored.");
+      return true;
+    }
+
+    return configure(t);
+  }
+
+  /**
+   * Register a module as variant of a function. All variants of a function
+   * implement the same functionality, but with different throughput and
+   * bitstream size. The module is registered like any other module, so it can
+   * still be configured directly as well.
+   *
+   * @tparam Module the type of the module that implements the variant
+   * @tparam Args types of optional arguments for the module construction
+   * @param function the name of the function that the module implements
+   * @param throughput_per_us the throughput of the module in work units per
+   * microsecond
+   * @param args optional arguments which may be needed to construct the module
+   */
+  template <typename Module,
+            typename = std::enable_if_t<
+                std::is_base_of<module_base_type, Module>::value>,
+            typename... Args>
+  void register_variant(const std::string &function, double throughput_per_us,
+                        Args... args) {
+    if (throughput_per_us <= 0) {
+      SC_REPORT_ERROR(name(), "Throughput of a variant has to be positive.");
+    }
+
+    do_register_module<Module>(args...);
+    m_variant_groups[function].push_back(
+        {find_module<Module>(), throughput_per_us});
+  }
+
+  /**
+   * Set the policy that selects which variant of a function is configured when
+   * the function is requested. The default policy minimizes the expected
+   * completion time.
+   *
+   * @param policy the new variant selection policy
+   * @see min_completion_time_policy
+   */
+  void set_variant_policy(std::shared_ptr<variant_selection_policy> policy) {
+    sc_assert(policy != nullptr);
+    m_variant_policy = std::move(policy);
+  }
+
+  /**
+   * Request a function for the given amount of work. The variant selection
+   * policy chooses one of the function's variants based on their throughput,
+   * the time needed to configure them, which is zero for a variant that is
+   * already configured, and the time the configured variant is still busy with
+   * the work of earlier requests. The chosen variant is then configured like
+   * with configure_module, unless it is configured already. Configuring
+   * another variant preempts the busy module, whose remaining work is dropped
+   * and counted.
+   *
+   * @param function the name of the requested function
+   * @param work the amount of work the function shall perform in work units
+   * @return instance pointer to the chosen variant, or nullptr if its load was
+   * aborted
+   */
+  module_ptr_t configure_function(const std::string &function, double work) {
+    check_not_frozen("configure a function");
+
+    auto it = m_variant_groups.find(function);
+    if (it == m_variant_groups.end()) {
+      SC_REPORT_ERROR(name(),
+                      "Cannot configure function that has no variants.");
+      return nullptr;
+    }
+
+    // the work of earlier requests is processed by the configured module,
+    // which may be a variant of another function as well
+    sc_core::sc_time now = sc_core::sc_time_stamp();
+    sc_core::sc_time busy_time = sc_core::SC_ZERO_TIME;
+    if (m_busy_variant != nullptr && m_busy_variant == m_current_module &&
+        m_busy_until > now) {
+      busy_time = m_busy_until - now;
+    }
+
+    std::vector<variant_candidate> candidates;
+    for (const auto &v : it->second) {
+      bool configured = v.module == m_current_module;
+      candidates.push_back(
+          {v.module.get(), v.throughput_per_us,
+           configured ? sc_core::SC_ZERO_TIME : get_delta_load_time(v.module),
+           configured ? busy_time : sc_core::SC_ZERO_TIME,
+           configured ? sc_core::SC_ZERO_TIME : busy_time, configured});
+    }
+
+    size_t selected = m_variant_policy->select(candidates, work);
+    sc_assert(selected < candidates.size() &&
+              "Variant selection policy chose an invalid variant.");
+
+    auto t = it->second[selected].module;
+    NC_REPORT_CONDITIONAL(name(), "Selected variant " << t->name()
+                                                      << " of function "
+                                                      << function)
+    bool configured = t == m_current_module;
+    if (!configured && busy_time > sc_core::SC_ZERO_TIME) {
+      double dropped =
+          busy_time / sc_core::sc_time(1, sc_core::SC_US) * m_busy_throughput;
+      NC_REPORT_CONDITIONAL(name(), "Variant " << t->name() << " preempts "
+                                               << m_busy_variant->name()
+                                               << ", dropped work: " << dropped)
+      m_variant_preemptions++;
+      m_preempted_work += dropped;
+      m_busy_variant = nullptr;
+    }
+    if (!configured && !configure(t)) return nullptr;
+
+    // a newly configured variant starts with the requested work right away
+    sc_core::sc_time start = sc_core::sc_time_stamp();
+    if (configured && m_busy_until > start) start = m_busy_until;
+    m_busy_variant = t;
+    m_busy_throughput = it->second[selected].throughput_per_us;
+    m_busy_until = start + sc_core::sc_time(work / m_busy_throughput,
+                                            sc_core::SC_US);
+    return t;
+  }
+
+  /**
+   * Get the number of times configure_function configured a variant while the
+   * configured module was still busy with the work of earlier requests.
+   *
+   * @return the number of preemptions
+   */
+  size_t get_variant_preemption_count() const { return m_variant_preemptions; }
+
+  /**
+   * Get the total work in work units that preempted modules did not finish.
+   *
+   * @return the preempted work
+   */
+  double get_preempted_work() const { return m_preempted_work; }
+
+  /**
+   * Preempt the currently configured module and configure the given module
+   * instead, like with configure_module. The context of the preempted module is
+   * saved before it is deactivated, and the context that the given module had
+   * when it was preempted the last time is restored after it was activated.
+   *
+   * @tparam Module the type of the module to configure
+   * @return true if the module is configured afterwards, false if it is not
+   * registered or its load was aborted
+   * @see abstract_module_base#on_save_context,
+   * abstract_module_base#on_restore_context
+   */
+  NC_INTERNAL_TMPL_BASE_OF(Module, configurable_base_type)
+  bool switch_module() {
+    check_not_frozen("switch the module");
+
+    auto t = find_module<Module>();
+    if (t == nullptr) {
+      SC_REPORT_ERROR(name(),
+                      "Cannot switch to module that is not registered.");
+      return false;
+    } else if (t == m_current_module) {
+      return true;
+    }
+
+    return configure(t, true);
+  }
+
+  /**
+   * Get the time needed to transfer the context of the given module, which is
+   * calculated from the reconfiguration speed of the interface and the size of
+   * the module's context.
+   *
+   * @param t the module whose context is transferred
+   * @return the context transfer time
+   * @see abstract_module_base#get_context_size_bytes
+   */
+  static sc_core::sc_time get_context_time(const module_ptr_t &t) {
+    double context_time_us =
+        t->get_context_size_bytes() / Interface::load_speed_MBps;
+    return sc_core::sc_time(context_time_us, sc_core::SC_US);
+  }
+
+  /**
+   * Get the time needed to load the given module, which is calculated from the
+   * reconfiguration speed of the interface and the modules size.
+   *
+   * @param t the module to load
+   * @return the load time
+   * @see abstract_module_base#get_bitstream_size_bytes
+   */
+  static sc_core::sc_time get_load_time(const module_ptr_t &t) {
+    return get_transfer_time(t->get_bitstream_size_bytes());
+  }
+
+  /**
+   * Get the time needed to load the given module into this region, given the
+   * frames that are currently in the region and the region's decompressor.
+   * Without a frame model and decompressor, this equals get_load_time.
+   *
+   * @param t the module to load
+   * @return the load time
+   * @see abstract_module_base#get_frame_signatures
+   */
+  sc_core::sc_time get_delta_load_time(const module_ptr_t &t) const {
+    return get_write_time(t, get_load_bytes(t));
+  }
+
+  /**
+   * Get the time needed to load the given module into this region again, once
+   * it was replaced by another module. With a frame model and frame signatures
+   * of both modules, only the frames that the replacement changes need to be
+   * written again. The region's decompressor is considered like for
+   * get_delta_load_time.
+   *
+   * @param t the module that is replaced
+   * @param replacement the module that replaces it
+   * @return the reload time
+   */
+  sc_core::sc_time get_reload_time(const module_ptr_t &t,
+                                   const module_ptr_t &replacement) const {
+    std::vector<size_t> signatures = t->get_frame_signatures();
+    std::vector<size_t> replaced = replacement->get_frame_signatures();
+    if (m_frames.empty() || signatures.empty() || replaced.empty()) {
+      return get_write_time(t, t->get_bitstream_size_bytes());
+    }
+    sc_assert(signatures.size() <= m_frames.size() &&
+              "Module has more frames than the region.");
+
+    size_t frames = 0;
+    for (size_t i = 0; i < signatures.size(); i++) {
+      // frames beyond those of the replacement stay as they are now
+      const std::optional<size_t> after =
+          i < replaced.size() ? std::optional<size_t>(replaced[i])
+                              : m_frames[i];
+      if (after != signatures[i]) frames++;
+    }
+    return get_write_time(t, std::max<size_t>(frames, 1) * m_frame_size_bytes);
+  }
+
+  /**
+   * Set the frame model of the region, so that loading a module only writes
+   * the frames that differ from those in the region, according to the
+   * module's frame signatures. The content of the frames is unknown until the
+   * first module with signatures is load.
+   *
+   * @param frame_count the size of the region in frames
+   * @param frame_size_bytes the size of one frame in byte
+   */
+  void set_frame_model(size_t frame_count, size_t frame_size_bytes) {
+    sc_assert(frame_count > 0 && frame_size_bytes > 0 &&
+              "Frame model must not be empty.");
+    m_frames.assign(frame_count, std::nullopt);
+    m_shadow_frames.assign(m_shadow_context ? frame_count : 0, std::nullopt);
+    m_frame_size_bytes = frame_size_bytes;
+  }
+
+  /**
+   * Get the number of bytes that were written by all reconfigurations so far.
+   *
+   * @return the number of loaded bytes
+   */
+  size_t get_loaded_bytes() const { return m_loaded_bytes; }
+
+  /**
+   * Set the decompressor of the region. Modules whose bitstream is compressed
+   * with the given scheme are then transferred compressed and decompressed at
+   * the given throughput.
+   *
+   * @param scheme the compression scheme supported by the decompressor
+   * @param throughput_MBps the throughput of the decompressor in uncompressed
+   * MB/s
+   * @see abstract_module_base#get_compressed_bitstream_size_bytes
+   */
+  void set_decompressor(const std::string &scheme, double throughput_MBps) {
+    sc_assert(throughput_MBps > 0 &&
+              "Decompressor throughput has to be larger than zero.");
+    m_decompressor_scheme = scheme;
+    m_decompressor_MBps = throughput_MBps;
+  }
+
+  /**
+   * Set the address of the bitstream of a registered module in the
+   * configuration memory, from which it is fetched if bitstream fetching is
+   * enabled.
+   *
+   * @tparam Module the type of the module
+   * @param address the address of the bitstream
+   * @see abstract_reconf_region_base#enable_bitstream_fetch
+   */
+  NC_INTERNAL_TMPL_BASE_OF(Module, configurable_base_type)
+  void set_bitstream_address(sc_dt::uint64 address) {
+    auto t = find_module<Module>();
+    if (t == nullptr) {
+      SC_REPORT_ERROR(name(),
+                      "Cannot set address of module that is not registered.");
       return;
     }
+    m_bitstream_addresses[t.get()] = address;
+  }
 
-    mark_reconf_begin();
-    block_transactions();
+  /**
+   * Get the speed at which uncompressed bitstream data was load on average
+   * over all reconfigurations so far.
+   *
+   * @return the effective load speed in MB/s or 0 if nothing was load yet
+   */
+  double get_effective_load_speed_MBps() const {
+    if (m_total_load_time == sc_core::SC_ZERO_TIME) return 0;
+    return m_loaded_bytes /
+           (m_total_load_time / sc_core::sc_time(1, sc_core::SC_US));
+  }
 
-    unload_module_unprotected();
+  /**
+   * Enable or disable demand configuration. While it is enabled, blocking
+   * transactions that arrive at a target socket of the reconfiguration region
+   * configure the module they demand before they are forwarded. A transaction
+   * demands a module either by a nc_module_tag extension or by its address
+   * falling into a range registered for the module.
+   *
+   * @param enable true to enable demand configuration, false to disable it
+   * @see conf_manager#demand_configure, conf_manager#register_demand_range
+   */
+  void enable_demand_configuration(bool enable = true) {
+    if (enable) check_not_frozen("enable demand configuration");
+    set_demand_configuration(enable);
+  }
 
-    m_current_module = t;
+  /**
+   * Register an address range for a module, so that transactions to this range
+   * demand the module. The module needs to be registered already.
+   *
+   * @tparam Module the type of the module that handles the range
+   * @param start the first address of the range
+   * @param end the last address of the range
+   */
+  NC_INTERNAL_TMPL_BASE_OF(Module, configurable_base_type)
+  void register_demand_range(sc_dt::uint64 start, sc_dt::uint64 end) {
+    auto t = find_module<Module>();
+    if (t == nullptr) {
+      SC_REPORT_ERROR(name(), "Cannot register demand range for module that "
+                              "is not registered.");
+      return;
+    }
+    if (start > end) {
+      SC_REPORT_ERROR(name(), "Demand range must not be empty.");
+      return;
+    }
+    m_demand_ranges.push_back({start, end, t});
+  }
 
-    // bit stream size in Byte, load speed in MByte -> * 1/1e6, convert second
-    // to us -> * 1e6 => no conversion
-    double load_time_us = m_current_module->get_bitstream_size_bytes() /
-                          Interface::load_speed_MBps;
-    NC_REPORT_CONDITIONAL(name(), "Reconfiguring module "
-                                      << m_current_module->name()
-                                      << ", load time [us]:" << load_time_us)
-    sc_assert(load_time_us > 0 &&
-              "Reconfiguration has to be larger that zero.");
-    sc_core::wait(sc_core::sc_time(load_time_us, sc_core::SC_US));
+  /**
+   * Configure the module that is demanded by the given transaction, unless it
+   * is configured already. If another reconfiguration is in progress, or the
+   * configured module still has transactions in progress, it is waited for
+   * those first. Returns as soon as the demanded module is load. Every
+   * reconfiguration that is triggered this way counts as demand miss. A load
+   * into the shadow context is only waited for if the demanded module is not
+   * configured, since the configured module keeps serving meanwhile.
+   * Transactions that demand no module are forwarded to the configured module.
+   *
+   * @param trans the incoming transaction
+   * @return false if the load of the demanded module was aborted
+   * @see conf_manager#enable_demand_configuration
+   */
+  bool demand_configure(const tlm::tlm_generic_payload &trans) {
+    module_ptr_t t = find_demanded_module(trans);
+    if (t == nullptr) {
+      if (m_current_module == nullptr) {
+        SC_REPORT_ERROR(name(), "Transaction demands no registered module and "
+                                "no module is configured.");
+        return false;
+      }
+      return true;
+    }
+    return demand_configure_module(t);
+  }
+
+  /**
+   * Check without waiting whether the module demanded by the given transaction
+   * can serve it right away. Otherwise, the demanded module is configured like
+   * by demand_configure, but by a spawned process, so that the transaction can
+   * be retried once the module is load. Only one such process is spawned at a
+   * time.
+   *
+   * @param trans the incoming transaction
+   * @return true if the transaction can be forwarded to the configured module
+   * @see conf_manager#demand_configure
+   */
+  bool request_demand_configuration(const tlm::tlm_generic_payload &trans) {
+    module_ptr_t t = find_demanded_module(trans);
+    if (t == nullptr) return m_current_module != nullptr;
+    if (t == m_current_module && !transactions_blocked()) return true;
+
+    if (!m_demand_requested) {
+      m_demand_requested = true;
+      sc_core::sc_spawn(
+          [this, t] {
+            demand_configure_module(t);
+            m_demand_requested = false;
+          },
+          sc_core::sc_gen_unique_name("demand_configure"));
+    }
+    return false;
+  }
+
+  /**
+   * Get the number of reconfigurations that were triggered by demand
+   * configuration so far.
+   *
+   * @return the number of demand misses
+   */
+  size_t get_demand_miss_count() const { return m_demand_misses; }
+
+  /**
+   * Register a software model for a module. While the reconfiguration region
+   * is empty or reconfigured, blocking and debug transactions that demand the
+   * module, or that demand no module while it is being configured, are served
+   * by the software model instead. The module needs to be registered already.
+   *
+   * @tparam Module the type of the module that the software model stands in
+   * for
+   * @param model the software model
+   * @see conf_manager#demand_configure
+   */
+  NC_INTERNAL_TMPL_BASE_OF(Module, configurable_base_type)
+  void register_software_model(std::shared_ptr<nc_software_model> model) {
+    auto t = find_module<Module>();
+    if (t == nullptr) {
+      SC_REPORT_ERROR(name(), "Cannot register software model for module that "
+                              "is not registered.");
+      return;
+    }
+    sc_assert(model != nullptr);
+    m_software_models[t.get()] = std::move(model);
+    set_software_fallback(true);
+  }
+
+  /**
+   * Serve a blocking transaction by the software model of the module that it
+   * demands or, if it demands none, of the module that is currently
+   * configured. Every served transaction counts as software request.
+   *
+   * @param trans a TLM transaction payload instance
+   * @param t a SystemC time
+   * @return true if the transaction was served, false if there is no software
+   * model for it
+   */
+  bool software_b_transport(tlm::tlm_generic_payload &trans,
+                            sc_core::sc_time &t) {
+    nc_software_model *model = find_software_model(trans);
+    if (model == nullptr) return false;
 
-    load_current_module();
+    m_software_requests++;
+    model->b_transport(trans, t);
+    return true;
   }
 
+  /**
+   * Serve a debug transaction by a software model, which is selected like for
+   * software_b_transport.
+   *
+   * @param trans a TLM transaction payload instance
+   * @param count the number of transferred bytes
+   * @return true if the transaction was served, false if there is no software
+   * model for it
+   */
+  bool software_transport_dbg(tlm::tlm_generic_payload &trans,
+                              unsigned int &count) {
+    nc_software_model *model = find_software_model(trans);
+    if (model == nullptr) return false;
+
+    count = model->transport_dbg(trans);
+    return true;
+  }
+
+  /**
+   * Get the number of blocking transactions that were served by software
+   * models so far.
+   *
+   * @return the number of software requests
+   */
+  size_t get_software_request_count() const { return m_software_requests; }
+
   /**
    * Unload the current module.
    * This function is a reconfiguration action and cannot be executed while any
@@ -461,13 +1757,346 @@ class conf_manager : public conf_manager_base {
    * @see conf_manager#unload_module_unprotected
    */
   void unload_module() {
-    mark_reconf_begin();
+    check_not_frozen("unload the module");
+    wait_shadow_load();
+
+    mark_reconf_begin(m_current_module.get(), nullptr);
+    quiesce_current_module();
+
+    unload_module_unprotected();
+
+    mark_reconf_end();
+  }
+
+  /**
+   * Quiesce the current module because the module in which the
+   * reconfiguration region is nested is about to be unloaded, before the
+   * containing module is blocked.
+   *
+   * @see conf_manager#perform_nested_unload
+   */
+  void perform_nested_quiesce() { quiesce_current_module(); }
+
+  /**
+   * Unload the current module because the module in which the reconfiguration
+   * region is nested is deactivated. A frozen module is unloaded as well, since
+   * it cannot outlive the module that contains the region. It is loaded again
+   * as preloaded module when the containing module is activated again. The
+   * module was quiesced by perform_nested_quiesce already, so this does not
+   * wait.
+   *
+   * @see conf_manager#unload_module
+   */
+  void perform_nested_unload() {
+    mark_reconf_begin(m_current_module.get(), nullptr);
 
     unload_module_unprotected();
 
     mark_reconf_end();
   }
 
+  /**
+   * Start the configuration of a registered module as part of a group of
+   * regions that are reconfigured together. The region is only marked as
+   * reconfiguring, without waiting, so that a group claims all of its regions
+   * at once. The configured module keeps running until it is unloaded by
+   * unload_for_group.
+   *
+   * @tparam Module the type of the module to configure
+   * @return false if the module is configured already or not registered, in
+   * which case the region is left as it is
+   * @see conf_manager#quiesce_for_group, conf_manager#unload_for_group,
+   * conf_manager#load_group_module, reconf_region_group
+   */
+  NC_INTERNAL_TMPL_BASE_OF(Module, configurable_base_type)
+  bool begin_group_configuration() {
+    check_not_frozen("configure a module");
+
+    auto t = find_module<Module>();
+    if (t == nullptr) {
+      SC_REPORT_ERROR(name(),
+                      "Cannot configure module that is not registered.");
+      return false;
+    } else if (t == m_current_module) {
+      return false;
+    }
+
+    mark_reconf_begin(m_current_module.get(), t.get());
+    m_group_module = t;
+    return true;
+  }
+
+  /**
+   * Tell the configured module of a started group configuration that it is
+   * about to be unloaded and wait until it acknowledged or the quiescence
+   * timeout expired.
+   *
+   * @see conf_manager#begin_group_configuration
+   */
+  void quiesce_for_group() {
+    sc_assert(m_group_module != nullptr && "No group configuration started.");
+    quiesce_current_module();
+  }
+
+  /**
+   * Block the region of a started group configuration and unload the
+   * configured module, which makes the module of the group the current one.
+   * Its bitstream is not loaded yet.
+   *
+   * @see conf_manager#load_group_module
+   */
+  void unload_for_group() {
+    sc_assert(m_group_module != nullptr && "No group configuration started.");
+    block_transactions();
+    unload_module_unprotected();
+    m_current_module = std::exchange(m_group_module, nullptr);
+  }
+
+  /**
+   * Give up a started group configuration before the configured module was
+   * unloaded, e.g. because another region of the group could not be claimed.
+   * The configured module keeps running.
+   *
+   * @see conf_manager#begin_group_configuration
+   */
+  void release_group_configuration() {
+    sc_assert(m_group_module != nullptr && "No group configuration started.");
+    m_group_module = nullptr;
+    mark_reconf_end();
+  }
+
+  /**
+   * Load the bitstream of the module whose group configuration was started.
+   * The module stays decoupled afterwards. If the load is aborted, the region
+   * is left empty and the group configuration ends.
+   *
+   * @return false if the load was aborted
+   * @see conf_manager#begin_group_configuration
+   */
+  bool load_group_module() {
+    sc_assert(m_current_module != nullptr && is_reconfiguring() &&
+              "No group configuration in progress.");
+    return load_bitstream();
+  }
+
+  /**
+   * Couple and activate the module whose bitstream was loaded by
+   * load_group_module, which ends the group configuration.
+   */
+  void end_group_configuration() { load_current_module(); }
+
+  /**
+   * End a group configuration without coupling the loaded module, because the
+   * load at another region of the group failed. The region is left empty.
+   */
+  void cancel_group_configuration() {
+    NC_REPORT_CONDITIONAL(name(), "Cancelled configuration of module "
+                                      << m_current_module->name())
+    m_current_module = nullptr;
+    unblock_transactions();
+    mark_reconf_end();
+  }
+
+  /**
+   * Get the total time spent transferring states that modules handed off to
+   * the modules that replaced them.
+   *
+   * @return the state hand-off time
+   * @see abstract_module_base#hand_off_state
+   */
+  sc_core::sc_time get_handoff_time() const { return m_handoff_time; }
+
+  /**
+   * Get the total number of bytes of states that modules handed off to the
+   * modules that replaced them.
+   *
+   * @return the number of handed off bytes
+   */
+  size_t get_handoff_bytes() const { return m_handoff_bytes; }
+
+  /**
+   * Get the number of handed off states that were lost, since the load of the
+   * module that should have taken them was aborted.
+   *
+   * @return the number of lost states
+   */
+  size_t get_lost_handoff_count() const { return m_lost_handoffs; }
+
+  /**
+   * Set the maximum time that a reconfiguration waits for the configured
+   * module to acknowledge that it is about to be unloaded. The module is
+   * unloaded after the timeout even if it still has work in flight.
+   *
+   * @param timeout the timeout, SC_ZERO_TIME to wait without limit (default)
+   * @see abstract_module_base#on_reconf_imminent
+   */
+  void set_quiescence_timeout(const sc_core::sc_time &timeout) {
+    m_quiescence_timeout = timeout;
+  }
+
+  /**
+   * Get the total time that reconfigurations waited for modules to
+   * acknowledge that they are about to be unloaded.
+   *
+   * @return the quiescence time
+   */
+  sc_core::sc_time get_quiescence_time() const { return m_quiescence_time; }
+
+  /**
+   * Get the number of times a module did not acknowledge before the
+   * quiescence timeout.
+   *
+   * @return the number of timeouts
+   */
+  size_t get_quiescence_timeout_count() const { return m_quiescence_timeouts; }
+
+  /**
+   * Give the region a second configuration context. A module can then be
+   * loaded into the inactive context while the configured module keeps
+   * serving transactions, and both are swapped in zero time afterwards. Must
+   * be called before the frame model is set, if any.
+   *
+   * @see conf_manager#load_shadow_module, conf_manager#swap_modules
+   */
+  void enable_shadow_context() {
+    m_shadow_context = true;
+    m_shadow_frames.assign(m_frames.size(), std::nullopt);
+  }
+
+  /**
+   * Check whether the region has a second configuration context.
+   *
+   * @return true if the region has a shadow context
+   */
+  bool has_shadow_context() const { return m_shadow_context; }
+
+  /**
+   * Load a registered module into the shadow context of the region. The
+   * configured module stays coupled and active while the bitstream is
+   * written, so the load time is hidden behind its operation. The region is
+   * thus not marked as reconfiguring, and no reconfiguration phases are
+   * reported. Other reconfigurations wait until the load has ended, and the
+   * load can be aborted, which leaves the shadow context empty.
+   *
+   * @tparam Module the type of the module to load
+   * @return false if the load failed or was aborted
+   * @see conf_manager#swap_modules,
+   * abstract_reconf_region_base#abort_configuration
+   */
+  NC_INTERNAL_TMPL_BASE_OF(Module, configurable_base_type)
+  bool load_shadow_module() {
+    check_not_frozen("load a shadow module");
+
+    auto t = find_module<Module>();
+    if (!m_shadow_context) {
+      SC_REPORT_ERROR(name(), "Region has no shadow context.");
+      return false;
+    } else if (t == nullptr) {
+      SC_REPORT_ERROR(name(), "Cannot load module that is not registered.");
+      return false;
+    } else if (t == m_current_module) {
+      SC_REPORT_ERROR(name(), "Cannot load the configured module into the "
+                              "shadow context.");
+      return false;
+    } else if (t == m_shadow_module) {
+      return true;
+    }
+
+    mark_shadow_load_begin();
+    m_shadow_module = nullptr;
+
+    // the load bytes are determined by the frames of the shadow context
+    std::swap(m_frames, m_shadow_frames);
+    size_t load_bytes = get_load_bytes(t);
+    std::swap(m_frames, m_shadow_frames);
+    sc_core::sc_time load_time = get_write_time(t, load_bytes);
+    NC_REPORT_CONDITIONAL(name(), "Loading module "
+                                      << t->name()
+                                      << " into shadow context, load time [us]:"
+                                      << load_time.to_seconds() * 1e6)
+
+    bool serving = m_current_module != nullptr;
+    sc_core::sc_time start = sc_core::sc_time_stamp();
+    begin_load();
+    bool loaded =
+        is_bitstream_fetch()
+            ? fetch_bitstream(get_bitstream_address(t),
+                              get_transferred_bytes(t, load_bytes), load_time)
+            : write_bitstream(load_bytes, load_time);
+    end_load();
+    sc_core::sc_time elapsed = sc_core::sc_time_stamp() - start;
+    m_total_load_time += elapsed;
+    m_shadow_load_time += elapsed;
+    if (serving) m_hidden_load_time += elapsed;
+
+    std::swap(m_frames, m_shadow_frames);
+    if (loaded) {
+      write_frames(t);
+      m_loaded_bytes += load_bytes;
+      m_shadow_module = t;
+    } else {
+      NC_REPORT_CONDITIONAL(name(), "Aborted loading module "
+                                        << t->name() << " into shadow context")
+      std::fill(m_frames.begin(), m_frames.end(), std::nullopt);
+    }
+    std::swap(m_frames, m_shadow_frames);
+
+    mark_shadow_load_end();
+    return loaded;
+  }
+
+  /**
+   * Swap the module in the shadow context with the configured one in zero
+   * time, unless the configured module hands off a state, whose transfer
+   * delays the swap. The previously configured module stays in the shadow
+   * context, so that swapping again restores it. Like unloading, the
+   * configured module must have no transactions in progress.
+   * Configuring the module in the shadow context by any other means swaps it
+   * in as well.
+   *
+   * @see conf_manager#load_shadow_module
+   */
+  void swap_modules() {
+    check_not_frozen("swap modules");
+
+    if (m_shadow_module == nullptr) {
+      SC_REPORT_ERROR(name(), "Cannot swap without a module in the shadow "
+                              "context.");
+      return;
+    }
+    swap_in_shadow_module();
+  }
+
+  /**
+   * Get a pointer to the instance of the module in the shadow context.
+   *
+   * @return instance pointer to the module or nullptr if the shadow context
+   * is empty
+   */
+  auto get_shadow_module() const { return m_shadow_module; }
+
+  /**
+   * Get the number of times modules were swapped so far.
+   *
+   * @return the number of swaps
+   */
+  size_t get_swap_count() const { return m_swaps; }
+
+  /**
+   * Get the time spent loading modules into the shadow context so far.
+   *
+   * @return the shadow load time
+   */
+  sc_core::sc_time get_shadow_load_time() const { return m_shadow_load_time; }
+
+  /**
+   * Get the part of the shadow load time during which a configured module
+   * kept serving, a.k.a. the reconfiguration time that was hidden.
+   *
+   * @return the hidden load time
+   */
+  sc_core::sc_time get_hidden_load_time() const { return m_hidden_load_time; }
+
   /**
    * Get a pointer to the instance of the currently configured module.
    *
@@ -508,6 +2137,106 @@ class conf_manager : public conf_manager_base {
   /// @brief pointer to the instance of the module that was registered for
   /// preloading, may be nullptr
   module_ptr_t m_preload_module = nullptr;
+  /// @brief pointer to the instance of the module of a started group
+  /// configuration, until the configured module was unloaded
+  module_ptr_t m_group_module = nullptr;
+  /// @brief pointer to the instance of the module whose members are bound
+  /// directly to those of the reconfiguration region, may be nullptr
+  module_ptr_t m_frozen_module = nullptr;
+  /// @brief flag indicating whether the adapters of the registered modules
+  /// have already been bound
+  bool m_modules_bound = false;
+
+  /// @brief A registered module that implements a function together with its
+  /// throughput.
+  struct variant {
+    module_ptr_t module;
+    double throughput_per_us;
+  };
+  /// @brief the variants of every function, accessed by the function's name
+  std::map<std::string, std::vector<variant>> m_variant_groups;
+  /// @brief the policy that selects a variant when a function is requested
+  std::shared_ptr<variant_selection_policy> m_variant_policy =
+      std::make_shared<min_completion_time_policy>();
+  /// @brief the variant that processes the work requested via
+  /// configure_function, if it is still configured
+  module_ptr_t m_busy_variant;
+  /// @brief the time at which the busy variant finishes the requested work
+  sc_core::sc_time m_busy_until = sc_core::SC_ZERO_TIME;
+  /// @brief the throughput of the busy variant in work units per microsecond
+  double m_busy_throughput = 0;
+  /// @brief number of busy variants that were preempted by configure_function
+  size_t m_variant_preemptions = 0;
+  /// @brief total work in work units that preempted variants did not finish
+  double m_preempted_work = 0;
+
+  /// @brief An address range whose transactions demand a module.
+  struct demand_range {
+    sc_dt::uint64 start;
+    sc_dt::uint64 end;
+    module_ptr_t module;
+  };
+  /// @brief the address ranges registered for demand configuration
+  std::vector<demand_range> m_demand_ranges;
+  /// @brief number of reconfigurations triggered by demand configuration
+  size_t m_demand_misses = 0;
+  /// @brief flag indicating whether a process spawned by
+  /// request_demand_configuration is still in progress
+  bool m_demand_requested = false;
+
+  /// @brief the software models of the modules
+  std::map<const configurable_base_type *, std::shared_ptr<nc_software_model>>
+      m_software_models;
+  /// @brief number of transactions served by software models
+  size_t m_software_requests = 0;
+
+  /// @brief the signature of every frame in the region, empty without a frame
+  /// model, std::nullopt for frames with unknown content
+  std::vector<std::optional<size_t>> m_frames;
+  /// @brief the size of one frame in byte
+  size_t m_frame_size_bytes = 0;
+  /// @brief number of bytes written by all reconfigurations
+  size_t m_loaded_bytes = 0;
+  /// @brief time spent writing bitstreams by all reconfigurations
+  sc_core::sc_time m_total_load_time = sc_core::SC_ZERO_TIME;
+  /// @brief the compression scheme supported by the decompressor
+  std::string m_decompressor_scheme;
+  /// @brief the throughput of the decompressor in MB/s, 0 without one
+  double m_decompressor_MBps = 0;
+  /// @brief the addresses of the modules' bitstreams in the configuration
+  /// memory
+  std::map<const configurable_base_type *, sc_dt::uint64>
+      m_bitstream_addresses;
+
+  /// @brief time spent transferring handed off states
+  sc_core::sc_time m_handoff_time = sc_core::SC_ZERO_TIME;
+  /// @brief number of bytes of handed off states
+  size_t m_handoff_bytes = 0;
+  /// @brief number of handed off states that were lost by aborted loads
+  size_t m_lost_handoffs = 0;
+
+  /// @brief maximum time to wait for a module's acknowledgement, SC_ZERO_TIME
+  /// for no limit
+  sc_core::sc_time m_quiescence_timeout = sc_core::SC_ZERO_TIME;
+  /// @brief time spent waiting for modules' acknowledgements
+  sc_core::sc_time m_quiescence_time = sc_core::SC_ZERO_TIME;
+  /// @brief number of acknowledgements that timed out
+  size_t m_quiescence_timeouts = 0;
+
+  /// @brief flag indicating whether the region has a second configuration
+  /// context
+  bool m_shadow_context = false;
+  /// @brief pointer to the instance of the module in the shadow context, may
+  /// be nullptr if it is empty
+  module_ptr_t m_shadow_module = nullptr;
+  /// @brief the signature of every frame in the shadow context, like m_frames
+  std::vector<std::optional<size_t>> m_shadow_frames;
+  /// @brief number of times modules were swapped
+  size_t m_swaps = 0;
+  /// @brief time spent loading modules into the shadow context
+  sc_core::sc_time m_shadow_load_time = sc_core::SC_ZERO_TIME;
+  /// @brief part of the shadow load time during which a module was configured
+  sc_core::sc_time m_hidden_load_time = sc_core::SC_ZERO_TIME;
 };
 
 #endif  // REGION_CONF_MANAGER_H_
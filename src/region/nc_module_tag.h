@@ -0,0 +1,63 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+#ifndef REGION_NC_MODULE_TAG_H_
+#define REGION_NC_MODULE_TAG_H_
+
+#include <tlm>
+#include <typeindex>
+#include <typeinfo>
+
+/**
+ * TLM extension that tags a transaction with the type of the module that shall
+ * handle it. When demand configuration is enabled at a reconfiguration region
+ * and a tagged transaction arrives while another or no module is configured,
+ * the tagged module is configured before the transaction is forwarded.
+ *
+ * @see conf_manager#demand_configure
+ */
+class nc_module_tag : public tlm::tlm_extension<nc_module_tag> {
+  /// @brief The type of the module that shall handle the transaction.
+  std::type_index m_module_type;
+
+ public:
+  /**
+   * Create a tag for the given module type.
+   *
+   * @param module_type the type of the module that shall handle the
+   * transaction
+   */
+  explicit nc_module_tag(std::type_index module_type)
+      : m_module_type(module_type) {}
+
+  /**
+   * Create a tag for the given module type.
+   *
+   * @tparam Module the type of the module that shall handle the transaction
+   * @return the tag
+   */
+  template <class Module>
+  static nc_module_tag of() {
+    return nc_module_tag(typeid(Module));
+  }
+
+  /**
+   * Get the type of the module that shall handle the transaction.
+   *
+   * @return the module type
+   */
+  std::type_index get_module_type() const { return m_module_type; }
+
+  tlm::tlm_extension_base *clone() const override {
+    return new nc_module_tag(m_module_type);
+  }
+
+  void copy_from(const tlm::tlm_extension_base &ext) override {
+    m_module_type = static_cast<const nc_module_tag &>(ext).m_module_type;
+  }
+};
+
+#endif  // REGION_NC_MODULE_TAG_H_
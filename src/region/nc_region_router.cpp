@@ -0,0 +1,202 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+#include "nc_region_router.h"
+
+#include <algorithm>
+
+#include "modules/abstract_module_base.h"
+
+nc_region_router::nc_region_router(const sc_core::sc_module_name &nm)
+    : sc_core::sc_module(nm), tsock("tsock") {
+  tsock.bind(*this);
+}
+
+void nc_region_router::map(std::type_index module_type, sc_dt::uint64 start,
+                           sc_dt::uint64 end) {
+  if (sc_core::sc_is_running()) {
+    SC_REPORT_ERROR(name(), "Cannot map module after elaboration.");
+    return;
+  }
+  if (start > end) {
+    SC_REPORT_ERROR(name(), "Mapped address range must not be empty.");
+    return;
+  }
+
+  // the next range must start behind and the previous one end before this one
+  auto next = m_routes.lower_bound(start);
+  bool overlaps = next != m_routes.end() && next->first <= end;
+  if (next != m_routes.begin()) {
+    overlaps |= std::prev(next)->second.end >= start;
+  }
+  if (overlaps) {
+    SC_REPORT_ERROR(name(), "Mapped address ranges must not overlap.");
+    return;
+  }
+
+  auto it = m_routes.emplace(start, route{start, end, {}, nullptr}).first;
+  m_module_routes[module_type].push_back(&it->second);
+}
+
+void nc_region_router::add_region(abstract_reconf_region_base &rr,
+                                  tlm::tlm_target_socket<> &rr_tsock) {
+  if (sc_core::sc_is_running()) {
+    SC_REPORT_ERROR(name(), "Cannot add region after elaboration.");
+    return;
+  }
+
+  m_ports.push_back(std::make_unique<region_port>(
+      *this, rr, sc_core::sc_gen_unique_name("region_isock")));
+  region_port *port = m_ports.back().get();
+  port->isock.bind(rr_tsock);
+
+  rr.add_module_listener(
+      [this, port](abstract_module_base *module, bool configured) {
+        update_routes(port, module, configured);
+      });
+  rr.add_reconf_listener(
+      [this, port](abstract_reconf_region_base::reconf_phase phase,
+                   abstract_module_base *, abstract_module_base *new_module) {
+        if (phase == abstract_reconf_region_base::reconf_phase::begin) {
+          update_loading(port, new_module, true);
+        } else if (phase == abstract_reconf_region_base::reconf_phase::end) {
+          update_loading(port, new_module, false);
+        }
+      });
+}
+
+void nc_region_router::update_routes(region_port *port,
+                                     abstract_module_base *module,
+                                     bool configured) {
+  auto it = m_module_routes.find(typeid(*module));
+  if (it == m_module_routes.end()) return;
+
+  for (route *r : it->second) {
+    region_port *old_port = r->port();
+    auto pos = std::find(r->ports.begin(), r->ports.end(), port);
+    if (configured && pos == r->ports.end()) {
+      r->ports.push_back(port);
+    } else if (!configured && pos != r->ports.end()) {
+      r->ports.erase(pos);
+    }
+
+    // pointers into the module at the previous region must not be used anymore
+    if (old_port != nullptr && old_port != r->port()) {
+      tsock->invalidate_direct_mem_ptr(r->start, r->end);
+    }
+  }
+}
+
+void nc_region_router::update_loading(region_port *port,
+                                      abstract_module_base *module,
+                                      bool loading) {
+  if (module == nullptr) return;
+  auto it = m_module_routes.find(typeid(*module));
+  if (it == m_module_routes.end()) return;
+
+  for (route *r : it->second) {
+    if (loading) {
+      r->loading = port;
+    } else if (r->loading == port) {
+      r->loading = nullptr;
+    }
+  }
+}
+
+nc_region_router::region_port *nc_region_router::decode(
+    tlm::tlm_generic_payload &trans, bool blocking, bool configured_only) {
+  route *r = find_route(trans.get_address());
+  region_port *port = r != nullptr ? r->port() : nullptr;
+
+  // the region that configures the module may serve the transaction meanwhile
+  if (r != nullptr && port == nullptr && !configured_only &&
+      r->loading != nullptr) {
+    const abstract_reconf_region_base &rr = r->loading->region;
+    if (rr.is_software_fallback() ||
+        (blocking && rr.is_demand_configuration())) {
+      port = r->loading;
+    }
+  }
+
+  if (port == nullptr) {
+    trans.set_response_status(tlm::TLM_ADDRESS_ERROR_RESPONSE);
+    return nullptr;
+  }
+  trans.set_address(trans.get_address() - r->start);
+  return port;
+}
+
+void nc_region_router::b_transport(tlm::tlm_generic_payload &trans,
+                                   sc_core::sc_time &t) {
+  region_port *port = decode(trans, true);
+  if (port == nullptr) return;
+  port->isock->b_transport(trans, t);
+}
+
+tlm::tlm_sync_enum nc_region_router::nb_transport_fw(
+    tlm::tlm_generic_payload &trans, tlm::tlm_phase &phase,
+    sc_core::sc_time &t) {
+  region_port *port;
+  if (phase == tlm::BEGIN_REQ) {
+    port = decode(trans, false, true);
+    if (port == nullptr) return tlm::TLM_COMPLETED;
+    m_pending[&trans] = port;
+  } else {
+    auto it = m_pending.find(&trans);
+    sc_assert(it != m_pending.end() && "Unknown transaction.");
+    port = it->second;
+  }
+
+  tlm::tlm_sync_enum status = port->isock->nb_transport_fw(trans, phase, t);
+  if (status == tlm::TLM_COMPLETED || phase == tlm::END_RESP) {
+    m_pending.erase(&trans);
+  }
+  return status;
+}
+
+bool nc_region_router::get_direct_mem_ptr(tlm::tlm_generic_payload &trans,
+                                          tlm::tlm_dmi &dmi_data) {
+  route *r = find_route(trans.get_address());
+  region_port *port = decode(trans, false, true);
+  if (port == nullptr) return false;
+
+  bool granted = port->isock->get_direct_mem_ptr(trans, dmi_data);
+
+  // translate the granted range back, but never beyond the mapped range
+  sc_dt::uint64 size = r->end - r->start;
+  dmi_data.set_start_address(
+      r->start + std::min(dmi_data.get_start_address(), size));
+  dmi_data.set_end_address(r->start +
+                           std::min(dmi_data.get_end_address(), size));
+  return granted;
+}
+
+unsigned int nc_region_router::transport_dbg(tlm::tlm_generic_payload &trans) {
+  region_port *port = decode(trans, false);
+  if (port == nullptr) return 0;
+  return port->isock->transport_dbg(trans);
+}
+
+tlm::tlm_sync_enum nc_region_router::region_port::nb_transport_bw(
+    tlm::tlm_generic_payload &trans, tlm::tlm_phase &phase,
+    sc_core::sc_time &t) {
+  tlm::tlm_sync_enum status = router.tsock->nb_transport_bw(trans, phase, t);
+  if (status == tlm::TLM_COMPLETED) router.m_pending.erase(&trans);
+  return status;
+}
+
+void nc_region_router::region_port::invalidate_direct_mem_ptr(
+    sc_dt::uint64 start_range, sc_dt::uint64 end_range) {
+  // translate to the global ranges of the modules configured at this region
+  for (auto &entry : router.m_routes) {
+    route &r = entry.second;
+    sc_dt::uint64 size = r.end - r.start;
+    if (r.port() != this || start_range > size) continue;
+
+    router.tsock->invalidate_direct_mem_ptr(
+        r.start + start_range, r.start + std::min(end_range, size));
+  }
+}
@@ -0,0 +1,239 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+#ifndef REGION_NC_REGION_ROUTER_H_
+#define REGION_NC_REGION_ROUTER_H_
+
+#include <map>
+#include <memory>
+#include <systemc>
+#include <tlm>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+#include <vector>
+
+#include "region/abstract_reconf_region_base.h"
+
+/**
+ * TLM router that forwards transactions to the reconfiguration region at which
+ * the addressed module is currently configured. Every module type is mapped
+ * to one or more address ranges. The router listens to the reconfiguration
+ * regions it was connected to, so that the routes follow a module when it is
+ * configured at another region. Transactions are forwarded with the address
+ * relative to the start of the mapped range. If a module is configured at
+ * several regions, transactions go to the region it was configured at first.
+ * While a module is not configured at any region, but is being configured at
+ * one, blocking and debug transactions are forwarded to that region if it can
+ * serve them meanwhile, by its software fallback or, for blocking ones, by
+ * demand configuration. Transactions to addresses that are not mapped, or
+ * whose module cannot be reached otherwise, fail with an address error.
+ * When a module is unloaded or moves to another region, the DMI pointers for
+ * its ranges are invalidated.
+ */
+class nc_region_router : public sc_core::sc_module,
+                         public tlm::tlm_fw_transport_if<> {
+  /**
+   * Connection to the target socket of one reconfiguration region. It provides
+   * the backward path for the transactions forwarded to the region.
+   */
+  struct region_port : public tlm::tlm_bw_transport_if<> {
+    nc_region_router &router;
+    abstract_reconf_region_base &region;
+    tlm::tlm_initiator_socket<> isock;
+
+    region_port(nc_region_router &p_router,
+                abstract_reconf_region_base &p_region, const char *nm)
+        : router(p_router), region(p_region), isock(nm) {
+      isock.bind(*this);
+    }
+
+    tlm::tlm_sync_enum nb_transport_bw(tlm::tlm_generic_payload &trans,
+                                       tlm::tlm_phase &phase,
+                                       sc_core::sc_time &t) override;
+
+    void invalidate_direct_mem_ptr(sc_dt::uint64 start_range,
+                                   sc_dt::uint64 end_range) override;
+  };
+
+  /**
+   * An address range that is mapped to a module type, together with the
+   * regions the module is configured at.
+   */
+  struct route {
+    sc_dt::uint64 start;
+    sc_dt::uint64 end;
+    /// @brief the ports of the regions the module is configured at, in the
+    /// order it was configured there
+    std::vector<region_port *> ports;
+    /// @brief the port of the region the module is being configured at or
+    /// nullptr
+    region_port *loading;
+
+    /**
+     * Get the port that transactions to the configured module go to.
+     *
+     * @return the port or nullptr if the module is not configured
+     */
+    region_port *port() const { return ports.empty() ? nullptr : ports[0]; }
+  };
+
+  /**
+   * Find the route for the given address in O(log n).
+   *
+   * @param address the global address
+   * @return the route or nullptr if the address is not mapped
+   */
+  route *find_route(sc_dt::uint64 address) {
+    auto it = m_routes.upper_bound(address);
+    if (it == m_routes.begin()) return nullptr;
+    --it;
+    return address <= it->second.end ? &it->second : nullptr;
+  }
+
+  /**
+   * Find the port for the transaction and translate its address to the range,
+   * or set the address error response if the module cannot be reached. If the
+   * module is not configured, the region it is being configured at is used
+   * if that region can serve the transaction meanwhile.
+   *
+   * @param trans the transaction
+   * @param blocking true if the transaction is a blocking one, which may wait
+   * for a demand configuration, false for debug transactions
+   * @param configured_only true if only a configured module can serve the
+   * transaction, like a non-blocking one or a DMI request
+   * @return the port or nullptr if the transaction cannot be forwarded
+   */
+  region_port *decode(tlm::tlm_generic_payload &trans, bool blocking,
+                      bool configured_only = false);
+
+  /**
+   * Update the routes of the given module when it was configured at or
+   * unloaded from the region of the given port.
+   *
+   * @param port the port of the region
+   * @param module the module
+   * @param configured true if the module was configured, false if it was
+   * unloaded
+   */
+  void update_routes(region_port *port, abstract_module_base *module,
+                     bool configured);
+
+  /**
+   * Remember at which region a module is being configured, so that
+   * transactions can be forwarded to it meanwhile.
+   *
+   * @param port the port of the region
+   * @param module the module that is configured, may be nullptr
+   * @param loading true when the reconfiguration began, false when it ended
+   */
+  void update_loading(region_port *port, abstract_module_base *module,
+                      bool loading);
+
+  /**
+   * Map an address range to the given module type.
+   *
+   * @param module_type the type of the module
+   * @param start the first address of the range
+   * @param end the last address of the range
+   */
+  void map(std::type_index module_type, sc_dt::uint64 start,
+           sc_dt::uint64 end);
+
+ public:
+  /// @brief The target socket at which the static side sends transactions.
+  tlm::tlm_target_socket<> tsock;
+
+  /**
+   * Construct a router with the given name.
+   *
+   * @param nm the name of the router
+   */
+  explicit nc_region_router(const sc_core::sc_module_name &nm);
+
+  /**
+   * Map an address range to the given module type. Ranges must not overlap.
+   * Must be called during elaboration.
+   *
+   * @tparam Module the type of the module
+   * @param start the first address of the range
+   * @param end the last address of the range
+   */
+  template <class Module>
+  void map_module(sc_dt::uint64 start, sc_dt::uint64 end) {
+    map(typeid(Module), start, end);
+  }
+
+  /**
+   * Connect a reconfiguration region to the router. The router binds to the
+   * given target socket of the region and forwards transactions to it while
+   * one of the mapped modules is configured there. Must be called during
+   * elaboration.
+   *
+   * @param rr the reconfiguration region
+   * @param rr_tsock the target socket exposed by the region
+   */
+  void add_region(abstract_reconf_region_base &rr,
+                  tlm::tlm_target_socket<> &rr_tsock);
+
+  /**
+   * Implementation of tlm_fw_transport_if<>.
+   * Forwards the call to the region the addressed module is configured at.
+   *
+   * @param trans a TLM transaction payload instance
+   * @param t a SystemC time
+   */
+  void b_transport(tlm::tlm_generic_payload &trans,
+                   sc_core::sc_time &t) override;
+
+  /**
+   * Implementation of tlm_fw_transport_if<>.
+   * Forwards the call to the region the addressed module is configured at.
+   * Only the request is routed by its address, all later phases of the
+   * transaction go to the same region.
+   *
+   * @param trans a TLM transaction payload instance
+   * @param phase a TLM transaction phase instance
+   * @param t a SystemC time
+   * @return a TLM sync value
+   */
+  tlm::tlm_sync_enum nb_transport_fw(tlm::tlm_generic_payload &trans,
+                                     tlm::tlm_phase &phase,
+                                     sc_core::sc_time &t) override;
+
+  /**
+   * Implementation of tlm_fw_transport_if<>.
+   * Forwards the call to the region the addressed module is configured at and
+   * translates the granted DMI range back to global addresses.
+   *
+   * @param trans a TLM transaction payload instance
+   * @param dmi_data a TLM DMI instance
+   * @return boolean indication the success of the operation
+   */
+  bool get_direct_mem_ptr(tlm::tlm_generic_payload &trans,
+                          tlm::tlm_dmi &dmi_data) override;
+
+  /**
+   * Implementation of tlm_fw_transport_if<>.
+   * Forwards the call to the region the addressed module is configured at.
+   *
+   * @param trans a TLM transaction payload instance
+   * @return arbitrary debug value
+   */
+  unsigned int transport_dbg(tlm::tlm_generic_payload &trans) override;
+
+ private:
+  /// @brief the connections to the regions
+  std::vector<std::unique_ptr<region_port>> m_ports;
+  /// @brief the mapped address ranges, accessed by their start address
+  std::map<sc_dt::uint64, route> m_routes;
+  /// @brief the mapped address ranges of every module type
+  std::unordered_map<std::type_index, std::vector<route *>> m_module_routes;
+  /// @brief the port of every non-blocking transaction that is in progress
+  std::unordered_map<tlm::tlm_generic_payload *, region_port *> m_pending;
+};
+
+#endif  // REGION_NC_REGION_ROUTER_H_
@@ -0,0 +1,49 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+#ifndef REGION_NC_SOFTWARE_MODEL_H_
+#define REGION_NC_SOFTWARE_MODEL_H_
+
+#include <systemc>
+#include <tlm>
+
+/**
+ * Base class for software stand-ins of modules. A software model implements
+ * the same function as its module and serves transactions to a reconfiguration
+ * region while the module cannot, a.k.a. while the region is empty or
+ * reconfigured. The model annotates its own (usually slower) timing to the
+ * transactions it serves.
+ *
+ * @see conf_manager#register_software_model
+ */
+class nc_software_model {
+ public:
+  virtual ~nc_software_model() = default;
+
+  /**
+   * Serve a blocking transaction in software. Non-blocking transactions are
+   * served by this function as well and completed right away, so it should
+   * only annotate its timing instead of waiting.
+   *
+   * @param trans a TLM transaction payload instance
+   * @param t a SystemC time, to which the processing time shall be added
+   */
+  virtual void b_transport(tlm::tlm_generic_payload &trans,
+                           sc_core::sc_time &t) = 0;
+
+  /**
+   * Serve a debug transaction in software. By default, no data is
+   * transferred.
+   *
+   * @param trans a TLM transaction payload instance
+   * @return the number of transferred bytes
+   */
+  virtual unsigned int transport_dbg(tlm::tlm_generic_payload &trans) {
+    return 0;
+  }
+};
+
+#endif  // REGION_NC_SOFTWARE_MODEL_H_
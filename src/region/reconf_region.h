@@ -41,10 +41,44 @@ class reconf_region : public Interface::rr_base {
   /**
    * Actually load the module that was registered for preload.
    */
-  void do_preload() override {
-    // no adapter syncing when we perform a preload before the simulation starts
-    // (non-nested preload)
-    m_conf.perform_preload(this->is_nested_rr());
+  void do_preload() override { m_conf.perform_preload(); }
+
+  /**
+   * Quiesce the current module, since the module in which the region is
+   * nested is about to be unloaded.
+   */
+  void do_nested_quiesce() override { m_conf.perform_nested_quiesce(); }
+
+  /**
+   * Unload the current module, even a frozen one, since the module in which
+   * the region is nested is deactivated.
+   */
+  void do_nested_unload() override { m_conf.perform_nested_unload(); }
+
+  /**
+   * Serve a blocking transaction by a software model.
+   *
+   * @param trans a TLM transaction payload instance
+   * @param t a SystemC time
+   * @return true if the transaction was served, false otherwise
+   * @implements abstract_reconf_region_base#software_b_transport
+   */
+  bool software_b_transport(tlm::tlm_generic_payload& trans,
+                            sc_core::sc_time& t) final {
+    return m_conf.software_b_transport(trans, t);
+  }
+
+  /**
+   * Serve a debug transaction by a software model.
+   *
+   * @param trans a TLM transaction payload instance
+   * @param count the number of transferred bytes
+   * @return true if the transaction was served, false otherwise
+   * @implements abstract_reconf_region_base#software_transport_dbg
+   */
+  bool software_transport_dbg(tlm::tlm_generic_payload& trans,
+                              unsigned int& count) final {
+    return m_conf.software_transport_dbg(trans, count);
   }
 
   /**
@@ -58,6 +92,16 @@ class reconf_region : public Interface::rr_base {
     if (!this->is_nested_rr()) do_preload();
   }
 
+  /**
+   * Called by systemC before the end of elaboration.
+   * Here the adapters of this reconfiguration region are bound to its members,
+   * unless a module was frozen at it. The configuration manager binds the
+   * modules, or the members of the frozen module directly to ours.
+   */
+  void before_end_of_elaboration() override {
+    if (!m_conf.is_frozen()) this->nc_bind_adapters();
+  }
+
  public:
   /**
    * Construct a reconfiguration region with a given name.
@@ -130,13 +174,409 @@ class reconf_region : public Interface::rr_base {
    * time.
    *
    * @tparam Module the type of the module that shall be configured
+   * @return true if the module is configured afterwards, false if it is not
+   * registered or its load was aborted
    * @see conf_manager#configure_module
    */
   template <class Module>
-  void configure_module() {
-    m_conf.template configure_module<Module>();
+  bool configure_module() {
+    return m_conf.template configure_module<Module>();
+  }
+
+  /**
+   * Preempt the configured module, saving its context, and configure the given
+   * module, restoring its context from its last preemption.
+   *
+   * @tparam Module the type of the module that shall be configured
+   * @return true if the module is configured afterwards, false if it is not
+   * registered or its load was aborted
+   * @see conf_manager#switch_module
+   */
+  template <class Module>
+  bool switch_module() {
+    return m_conf.template switch_module<Module>();
+  }
+
+  /**
+   * Register a module as variant of a function, annotated with its throughput.
+   * The variant's bitstream size is given by the module itself.
+   *
+   * @tparam Module the type of the module that implements the variant
+   * @tparam Args types of optional arguments for the module construction
+   * @param function the name of the function that the module implements
+   * @param throughput_per_us the throughput of the module in work units per
+   * microsecond
+   * @param args optional arguments which may be needed to construct the module
+   * @see conf_manager#register_variant
+   */
+  template <class Module, typename... Args>
+  void register_variant(const std::string& function, double throughput_per_us,
+                        Args... args) {
+    m_conf.template register_variant<Module>(function, throughput_per_us,
+                                             args...);
+  }
+
+  /**
+   * Set the policy that selects a variant when a function is requested.
+   *
+   * @param policy the new variant selection policy
+   * @see conf_manager#set_variant_policy
+   */
+  void set_variant_policy(std::shared_ptr<variant_selection_policy> policy) {
+    m_conf.set_variant_policy(std::move(policy));
+  }
+
+  /**
+   * Request a function for the given amount of work. The selection policy
+   * chooses one of the function's variants, which is then configured unless it
+   * is configured already.
+   *
+   * @param function the name of the requested function
+   * @param work the amount of work the function shall perform in work units
+   * @return instance pointer to the chosen variant, or nullptr if its load was
+   * aborted
+   * @see conf_manager#configure_function
+   */
+  auto configure_function(const std::string& function, double work) {
+    return m_conf.configure_function(function, work);
+  }
+
+  /**
+   * Get the number of times configure_function preempted a busy module.
+   *
+   * @return the number of preemptions
+   * @see conf_manager#get_variant_preemption_count
+   */
+  size_t get_variant_preemption_count() const {
+    return m_conf.get_variant_preemption_count();
+  }
+
+  /**
+   * Get the total work that preempted modules did not finish.
+   *
+   * @return the preempted work in work units
+   * @see conf_manager#get_preempted_work
+   */
+  double get_preempted_work() const { return m_conf.get_preempted_work(); }
+
+  /**
+   * Enable or disable demand configuration, which lets blocking transactions
+   * to this reconfiguration region configure the module they demand.
+   *
+   * @param enable true to enable demand configuration, false to disable it
+   * @see conf_manager#enable_demand_configuration
+   */
+  void enable_demand_configuration(bool enable = true) {
+    m_conf.enable_demand_configuration(enable);
+  }
+
+  /**
+   * Register an address range for a module, so that transactions to this range
+   * demand the module.
+   *
+   * @tparam Module the type of the module that handles the range
+   * @param start the first address of the range
+   * @param end the last address of the range
+   * @see conf_manager#register_demand_range
+   */
+  template <class Module>
+  void register_demand_range(sc_dt::uint64 start, sc_dt::uint64 end) {
+    m_conf.template register_demand_range<Module>(start, end);
+  }
+
+  /**
+   * Configure the module that is demanded by the given transaction.
+   *
+   * @param trans the incoming transaction
+   * @return false if the load of the demanded module was aborted
+   * @implements abstract_reconf_region_base#demand_configure
+   */
+  bool demand_configure(const tlm::tlm_generic_payload& trans) final {
+    return m_conf.demand_configure(trans);
+  }
+
+  /**
+   * Start the configuration of the module that is demanded by the given
+   * transaction, unless it can serve the transaction right away.
+   *
+   * @param trans the incoming transaction
+   * @return true if the transaction can be forwarded to the configured module
+   * @implements abstract_reconf_region_base#request_demand_configuration
+   */
+  bool request_demand_configuration(
+      const tlm::tlm_generic_payload& trans) final {
+    return m_conf.request_demand_configuration(trans);
+  }
+
+  /**
+   * Get the number of reconfigurations that were triggered by demand
+   * configuration so far.
+   *
+   * @return the number of demand misses
+   * @see conf_manager#get_demand_miss_count
+   */
+  size_t get_demand_miss_count() const {
+    return m_conf.get_demand_miss_count();
+  }
+
+  /**
+   * Register a software model that serves transactions for a module while the
+   * module cannot.
+   *
+   * @tparam Module the type of the module that the software model stands in
+   * for
+   * @param model the software model
+   * @see conf_manager#register_software_model
+   */
+  template <class Module>
+  void register_software_model(std::shared_ptr<nc_software_model> model) {
+    m_conf.template register_software_model<Module>(std::move(model));
+  }
+
+  /**
+   * Get the number of blocking transactions that were served by software
+   * models so far.
+   *
+   * @return the number of software requests
+   * @see conf_manager#get_software_request_count
+   */
+  size_t get_software_request_count() const {
+    return m_conf.get_software_request_count();
+  }
+
+  /**
+   * Set the frame model of this reconfiguration region, so that switching
+   * between modules with frame signatures only loads the differing frames.
+   *
+   * @param frame_count the size of the region in frames
+   * @param frame_size_bytes the size of one frame in byte
+   * @see conf_manager#set_frame_model
+   */
+  void set_frame_model(size_t frame_count, size_t frame_size_bytes) {
+    m_conf.set_frame_model(frame_count, frame_size_bytes);
+  }
+
+  /**
+   * Get the time needed to load a registered module into this region, given
+   * the frames that are currently in the region.
+   *
+   * @tparam Module the type of the module
+   * @return the load time
+   * @see conf_manager#get_delta_load_time
+   */
+  template <class Module>
+  sc_core::sc_time get_delta_load_time() const {
+    return m_conf.get_delta_load_time(m_conf.template get_module<Module>());
+  }
+
+  /**
+   * Get the time needed to configure the current module again, once it was
+   * replaced by a registered module.
+   *
+   * @tparam Replacement the type of the module that replaces the current one
+   * @return the reload time or zero if no module is configured
+   * @see conf_manager#get_reload_time
+   */
+  template <class Replacement>
+  sc_core::sc_time get_reload_time() const {
+    auto t = m_conf.get_current_module();
+    if (t == nullptr) return sc_core::SC_ZERO_TIME;
+    return m_conf.get_reload_time(t,
+                                  m_conf.template get_module<Replacement>());
+  }
+
+  /**
+   * Get the number of bytes that were written by all reconfigurations of this
+   * region so far.
+   *
+   * @return the number of loaded bytes
+   * @see conf_manager#get_loaded_bytes
+   */
+  size_t get_loaded_bytes() const { return m_conf.get_loaded_bytes(); }
+
+  /**
+   * Set the decompressor of this reconfiguration region, so that bitstreams
+   * compressed with the given scheme are transferred compressed.
+   *
+   * @param scheme the compression scheme supported by the decompressor
+   * @param throughput_MBps the throughput of the decompressor in uncompressed
+   * MB/s
+   * @see conf_manager#set_decompressor
+   */
+  void set_decompressor(const std::string& scheme, double throughput_MBps) {
+    m_conf.set_decompressor(scheme, throughput_MBps);
+  }
+
+  /**
+   * Set the address of the bitstream of a registered module in the
+   * configuration memory, from which it is fetched if bitstream fetching is
+   * enabled.
+   *
+   * @tparam Module the type of the module
+   * @param address the address of the bitstream
+   * @see conf_manager#set_bitstream_address
+   */
+  template <class Module>
+  void set_bitstream_address(sc_dt::uint64 address) {
+    m_conf.template set_bitstream_address<Module>(address);
+  }
+
+  /**
+   * Get the speed at which uncompressed bitstream data was load on average
+   * over all reconfigurations of this region so far.
+   *
+   * @return the effective load speed in MB/s or 0 if nothing was load yet
+   * @see conf_manager#get_effective_load_speed_MBps
+   */
+  double get_effective_load_speed_MBps() const {
+    return m_conf.get_effective_load_speed_MBps();
+  }
+
+  /**
+   * Get the total time spent transferring states that modules handed off to
+   * the modules that replaced them.
+   *
+   * @return the state hand-off time
+   * @see conf_manager#get_handoff_time
+   */
+  sc_core::sc_time get_handoff_time() const {
+    return m_conf.get_handoff_time();
+  }
+
+  /**
+   * Get the total number of bytes of states that modules handed off to the
+   * modules that replaced them.
+   *
+   * @return the number of handed off bytes
+   * @see conf_manager#get_handoff_bytes
+   */
+  size_t get_handoff_bytes() const { return m_conf.get_handoff_bytes(); }
+
+  /**
+   * Get the number of handed off states that were lost by aborted loads.
+   *
+   * @return the number of lost states
+   * @see conf_manager#get_lost_handoff_count
+   */
+  size_t get_lost_handoff_count() const {
+    return m_conf.get_lost_handoff_count();
+  }
+
+  /**
+   * Set the maximum time that a reconfiguration waits for the configured
+   * module to acknowledge that it is about to be unloaded.
+   *
+   * @param timeout the timeout, SC_ZERO_TIME to wait without limit
+   * @see conf_manager#set_quiescence_timeout
+   */
+  void set_quiescence_timeout(const sc_core::sc_time& timeout) {
+    m_conf.set_quiescence_timeout(timeout);
+  }
+
+  /**
+   * Get the total time that reconfigurations waited for modules to
+   * acknowledge that they are about to be unloaded.
+   *
+   * @return the quiescence time
+   * @see conf_manager#get_quiescence_time
+   */
+  sc_core::sc_time get_quiescence_time() const {
+    return m_conf.get_quiescence_time();
+  }
+
+  /**
+   * Get the number of times a module did not acknowledge before the
+   * quiescence timeout.
+   *
+   * @return the number of timeouts
+   * @see conf_manager#get_quiescence_timeout_count
+   */
+  size_t get_quiescence_timeout_count() const {
+    return m_conf.get_quiescence_timeout_count();
+  }
+
+  /**
+   * Start the configuration of a registered module as part of a group of
+   * regions. Used by reconf_region_group.
+   *
+   * @tparam Module the type of the module to configure
+   * @return false if the module is configured already or not registered
+   * @see conf_manager#begin_group_configuration
+   */
+  template <class Module>
+  bool begin_group_configuration() {
+    return m_conf.template begin_group_configuration<Module>();
   }
 
+  /**
+   * Wait until the configured module acknowledged a started group
+   * configuration.
+   *
+   * @see conf_manager#quiesce_for_group
+   */
+  void quiesce_for_group() { m_conf.quiesce_for_group(); }
+
+  /**
+   * Block this region and unload the configured module for a started group
+   * configuration.
+   *
+   * @see conf_manager#unload_for_group
+   */
+  void unload_for_group() { m_conf.unload_for_group(); }
+
+  /**
+   * Give up a started group configuration and keep the configured module.
+   *
+   * @see conf_manager#release_group_configuration
+   */
+  void release_group_configuration() { m_conf.release_group_configuration(); }
+
+  /**
+   * Load the bitstream of the module whose group configuration was started.
+   *
+   * @return false if the load was aborted
+   * @see conf_manager#load_group_module
+   */
+  bool load_group_module() { return m_conf.load_group_module(); }
+
+  /**
+   * Couple and activate the module that was loaded for a group.
+   *
+   * @see conf_manager#end_group_configuration
+   */
+  void end_group_configuration() { m_conf.end_group_configuration(); }
+
+  /**
+   * End a group configuration and leave this region empty.
+   *
+   * @see conf_manager#cancel_group_configuration
+   */
+  void cancel_group_configuration() { m_conf.cancel_group_configuration(); }
+
+  /**
+   * Freeze a registered module at this reconfiguration region. The members of
+   * the module are bound directly to those of the reconfiguration region, so
+   * that it runs without any adapter in between, as if it was part of the
+   * static design. The module is preloaded, but any further reconfiguration of
+   * this region results in an error. In a nested region, it is unloaded and
+   * loaded again together with the module that contains the region. Must be
+   * called during elaboration.
+   *
+   * @tparam Module the type of the module that shall be frozen
+   * @note Description copied from conf_manager#freeze
+   */
+  template <class Module>
+  void freeze() {
+    m_conf.template freeze<Module>();
+  }
+
+  /**
+   * Check whether a module is frozen at this reconfiguration region.
+   *
+   * @return true if a module is frozen, false otherwise
+   */
+  bool is_frozen() const { return m_conf.is_frozen(); }
+
   /**
    * Unload the currently configured module.
    *
@@ -178,7 +618,7 @@ class reconf_region : public Interface::rr_base {
     return m_conf.template is_registered<Module>();
   }
 
- private:
+ protected:
   /// @brief the configuration manger that contains the reconfiguration logic
   conf_manager<Interface> m_conf;
 };
@@ -0,0 +1,141 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+#include "reconf_region_group.h"
+
+#include <sysc/kernel/sc_spawn.h>
+
+#include <algorithm>
+
+bool reconf_region_group::configure(std::vector<member> members) {
+  if (m_configuring) {
+    SC_REPORT_ERROR(name(), "Group configuration already in progress.");
+    return false;
+  }
+  for (size_t i = 0; i < members.size(); i++) {
+    for (size_t j = i + 1; j < members.size(); j++) {
+      if (members[i].region == members[j].region) {
+        SC_REPORT_ERROR(name(), "Cannot configure a region twice in a group.");
+        return false;
+      }
+    }
+  }
+  m_configuring = true;
+
+  std::vector<member *> started = claim_members(members);
+  quiesce_members(started);
+
+  // all regions need to be blocked at the same time
+  sc_core::sc_time start = sc_core::sc_time_stamp();
+  for (auto *m : started) m->unload();
+
+  std::vector<bool> loaded(started.size(), false);
+  load_members(started, loaded);
+
+  bool all_loaded = std::all_of(loaded.begin(), loaded.end(),
+                                [](bool l) { return l; });
+  for (auto *m : started) {
+    if (all_loaded) {
+      m->end();
+    } else if (m->region->is_reconfiguring()) {
+      // regions whose load was aborted are left empty already
+      m->cancel();
+    }
+  }
+
+  m_downtime = sc_core::sc_time_stamp() - start;
+  m_total_downtime += m_downtime;
+  m_configurations++;
+  m_configuring = false;
+  NC_REPORT_CONDITIONAL(name(), "Group configuration "
+                                    << (all_loaded ? "finished" : "aborted")
+                                    << ", downtime [us]:"
+                                    << m_downtime.to_seconds() * 1e6)
+  return all_loaded;
+}
+
+std::vector<reconf_region_group::member *> reconf_region_group::claim_members(
+    std::vector<member> &members) {
+  // a load into a shadow context is waited for like a reconfiguration
+  auto is_reconfiguring = [](const member &m) {
+    return m.region->is_reconfiguring() || m.region->is_shadow_loading();
+  };
+
+  std::vector<member *> started;
+  for (;;) {
+    while (std::any_of(members.begin(), members.end(), is_reconfiguring)) {
+      sc_core::sc_event_or_list reconf_ends;
+      for (const auto &m : members) {
+        reconf_ends |= m.region->reconf_end_event();
+        reconf_ends |= m.region->shadow_load_end_event();
+      }
+      sc_core::wait(reconf_ends);
+    }
+
+    // a listener of a claimed region may still claim one of the others
+    bool claimed_all = true;
+    for (auto &m : members) {
+      if (is_reconfiguring(m)) {
+        claimed_all = false;
+        break;
+      }
+      if (m.begin()) started.push_back(&m);
+    }
+    if (claimed_all) return started;
+
+    for (auto *m : started) m->release();
+    started.clear();
+  }
+}
+
+void reconf_region_group::quiesce_members(
+    const std::vector<member *> &members) {
+  size_t finished = 0;
+  sc_core::sc_event member_quiesced;
+
+  // the locals outlive the processes, since this waits for all of them
+  for (auto *m : members) {
+    auto quiesce = [&, m] {
+      m->quiesce();
+      finished++;
+      member_quiesced.notify(sc_core::SC_ZERO_TIME);
+    };
+    sc_core::sc_spawn(quiesce, sc_core::sc_gen_unique_name("quiesce"));
+  }
+
+  while (finished < members.size()) sc_core::wait(member_quiesced);
+}
+
+void reconf_region_group::load_members(const std::vector<member *> &members,
+                                       std::vector<bool> &loaded) {
+  if (members.empty()) return;
+
+  size_t workers = m_parallel_loads == 0
+                       ? members.size()
+                       : std::min(m_parallel_loads, members.size());
+  size_t next = 0;
+  size_t finished = 0;
+  bool aborted = false;
+  sc_core::sc_event worker_finished;
+
+  // the locals outlive the workers, since this waits for all of them
+  auto work = [&] {
+    for (size_t i = next++; i < members.size() && !aborted; i = next++) {
+      loaded[i] = members[i]->load();
+      if (loaded[i]) continue;
+
+      aborted = true;
+      for (auto *m : members) m->region->abort_configuration();
+    }
+    finished++;
+    worker_finished.notify(sc_core::SC_ZERO_TIME);
+  };
+  for (size_t i = 0; i < workers; i++) {
+    sc_core::sc_spawn(work, sc_core::sc_gen_unique_name("load"));
+  }
+
+  while (finished < workers) sc_core::wait(worker_finished);
+}
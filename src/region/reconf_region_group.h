@@ -0,0 +1,168 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+#ifndef REGION_RECONF_REGION_GROUP_H_
+#define REGION_RECONF_REGION_GROUP_H_
+
+#include <functional>
+#include <systemc>
+#include <vector>
+
+#include "region/reconf_region.h"
+
+/**
+ * Reconfigures several regions, possibly of different interfaces, together,
+ * e.g. the stages of a pipeline that switches to another processing mode.
+ * All regions of a group configuration are claimed at once, then all of their
+ * modules are told about the reconfiguration and awaited together (see
+ * abstract_module_base#on_reconf_imminent), and finally all regions are
+ * blocked and their modules unloaded at the same time. The new
+ * bitstreams are then loaded concurrently, up to a limit of parallel loads,
+ * and all new modules are coupled at the same time once every load finished.
+ * So no region runs its new module while another one still runs the old mode.
+ * If the load at any region is aborted, the loads at the other regions are
+ * aborted as well and all regions of the group are left empty.
+ *
+ * @see reconf_region#begin_group_configuration
+ */
+class reconf_region_group : public sc_core::sc_module {
+ public:
+  /**
+   * A region of a group configuration together with the module to configure
+   * at it.
+   */
+  struct member {
+    abstract_reconf_region_base *region;
+    std::function<bool()> begin;
+    std::function<void()> quiesce;
+    std::function<void()> unload;
+    std::function<bool()> load;
+    std::function<void()> end;
+    std::function<void()> cancel;
+    std::function<void()> release;
+  };
+
+  /**
+   * Create a member of a group configuration.
+   *
+   * @tparam Module the type of the module to configure, which needs to be
+   * registered at the region
+   * @param rr the reconfiguration region
+   * @return the member
+   */
+  template <class Module, class Interface>
+  static member configure_at(reconf_region<Interface> &rr) {
+    member m;
+    m.region = &rr;
+    m.begin = [&rr] { return rr.template begin_group_configuration<Module>(); };
+    m.quiesce = [&rr] { rr.quiesce_for_group(); };
+    m.unload = [&rr] { rr.unload_for_group(); };
+    m.load = [&rr] { return rr.load_group_module(); };
+    m.end = [&rr] { rr.end_group_configuration(); };
+    m.cancel = [&rr] { rr.cancel_group_configuration(); };
+    m.release = [&rr] { rr.release_group_configuration(); };
+    return m;
+  }
+
+  /**
+   * Construct a group.
+   *
+   * @param nm the name of the group
+   */
+  explicit reconf_region_group(const sc_core::sc_module_name &nm)
+      : sc_core::sc_module(nm) {}
+
+  /**
+   * Set the maximum number of bitstreams that are loaded at the same time,
+   * e.g. the number of configuration ports that the regions share. By
+   * default, all bitstreams are loaded at the same time, each at the load
+   * speed of its region.
+   *
+   * @param loads the maximum number of parallel loads, 0 for no limit
+   */
+  void set_parallel_loads(size_t loads) { m_parallel_loads = loads; }
+
+  /**
+   * Configure the modules of all members at their regions together. Waits for
+   * ongoing reconfigurations at any of the regions first, also if another
+   * process claims one of the regions meanwhile. Regions at which the module
+   * is configured already keep running. Returns once all modules were coupled.
+   * The unloaded modules must not have transactions in progress.
+   *
+   * @param members the regions and their modules, every region at most once
+   * @return false if a load was aborted, which leaves all regions of the
+   * group empty
+   */
+  bool configure(std::vector<member> members);
+
+  /**
+   * Get the time during which the regions were unavailable at the last group
+   * configuration, from blocking them to coupling the new modules.
+   *
+   * @return the downtime
+   */
+  sc_core::sc_time get_downtime() const { return m_downtime; }
+
+  /**
+   * Get the summed downtime of all group configurations so far.
+   *
+   * @return the total downtime
+   */
+  sc_core::sc_time get_total_downtime() const { return m_total_downtime; }
+
+  /**
+   * Get the number of group configurations so far.
+   *
+   * @return the number of group configurations
+   */
+  size_t get_configuration_count() const { return m_configurations; }
+
+ private:
+  /**
+   * Wait until none of the regions of the given members is reconfiguring, and
+   * start the group configuration at all of them within the same evaluation,
+   * so that no other process can claim one of them in between.
+   *
+   * @param members the members of the group configuration
+   * @return the members whose configuration was started, i.e. whose module is
+   * not configured already
+   */
+  std::vector<member *> claim_members(std::vector<member> &members);
+
+  /**
+   * Tell the modules configured at the regions of the given members about the
+   * reconfiguration, and wait until all of them acknowledged or timed out.
+   * The modules are awaited at the same time, so the slowest one determines
+   * the waiting time.
+   *
+   * @param members the members whose configuration was started
+   */
+  void quiesce_members(const std::vector<member *> &members);
+
+  /**
+   * Load the bitstreams of the given members, the next pending one whenever
+   * a load finished, until all were loaded or a load was aborted.
+   *
+   * @param members the members whose configuration was started
+   * @param loaded set to true for every member whose bitstream was loaded
+   */
+  void load_members(const std::vector<member *> &members,
+                    std::vector<bool> &loaded);
+
+  /// @brief maximum number of parallel loads, 0 for no limit
+  size_t m_parallel_loads = 0;
+  /// @brief flag indicating whether a group configuration is in progress
+  bool m_configuring = false;
+
+  /// @brief downtime of the last group configuration
+  sc_core::sc_time m_downtime = sc_core::SC_ZERO_TIME;
+  /// @brief summed downtime of all group configurations
+  sc_core::sc_time m_total_downtime = sc_core::SC_ZERO_TIME;
+  /// @brief number of group configurations
+  size_t m_configurations = 0;
+};
+
+#endif  // REGION_RECONF_REGION_GROUP_H_
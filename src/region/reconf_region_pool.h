@@ -0,0 +1,298 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+#ifndef REGION_RECONF_REGION_POOL_H_
+#define REGION_RECONF_REGION_POOL_H_
+
+#include <limits>
+#include <memory>
+#include <systemc>
+#include <vector>
+
+#include "region/reconf_region.h"
+#include "region/replacement_policy.h"
+
+/**
+ * A pool of identical reconfiguration regions that serves requests for modules
+ * like a cache of hardware functions. Every module is registered at all regions
+ * of the pool. A request for a module is served by a region that has the module
+ * configured already (a hit). Otherwise, an empty region or, if there is none,
+ * the region selected by the replacement policy is reconfigured (a miss).
+ * The pool keeps track of hits, misses and the time that requests spent
+ * waiting for reconfigurations.
+ * The exposed members of the regions need to be bound individually, like those
+ * of any other reconfiguration region.
+ *
+ * @tparam Interface the interface of all regions in the pool
+ * @see replacement_policy
+ */
+template <class Interface>
+class reconf_region_pool : public sc_core::sc_module {
+ public:
+  typedef reconf_region<Interface> region_type;
+
+ private:
+  /// @brief Index that denotes that no region was found.
+  static constexpr size_t npos = std::numeric_limits<size_t>::max();
+
+  /**
+   * Find the region at which the given module is configured or is reserved to
+   * be configured by another request.
+   *
+   * @tparam Module the type of the module to look for
+   * @return the index of the region or npos if there is none
+   */
+  template <class Module>
+  size_t find_region() {
+    for (size_t i = 0; i < m_regions.size(); i++) {
+      auto &rr = m_regions[i];
+      auto module = rr.template get_module<Module>();
+      if ((m_slots[i].reserved && m_slots[i].module == module.get()) ||
+          (rr.get_current_module() != nullptr &&
+           rr.get_current_module() == module)) {
+        return i;
+      }
+    }
+    return npos;
+  }
+
+  /**
+   * Find the region that shall be reconfigured for the next miss. Empty
+   * regions are taken first, then the replacement policy selects among all
+   * regions that are neither reconfigured nor reserved at the moment.
+   *
+   * @tparam Module the type of the requested module
+   * @return the index of the region or npos if all regions are reconfigured
+   * at the moment
+   */
+  template <class Module>
+  size_t find_victim() {
+    std::vector<replacement_candidate> candidates;
+    std::vector<size_t> indices;
+
+    for (size_t i = 0; i < m_regions.size(); i++) {
+      auto &rr = m_regions[i];
+      if (rr.is_reconfiguring() || m_slots[i].reserved) continue;
+
+      auto module = rr.get_current_module();
+      if (module == nullptr) return i;
+
+      candidates.push_back({module.get(), m_slots[i].last_use,
+                            m_slots[i].use_count,
+                            rr.template get_reload_time<Module>()});
+      indices.push_back(i);
+    }
+
+    if (candidates.empty()) return npos;
+
+    size_t victim = m_policy->select_victim(candidates);
+    sc_assert(victim < candidates.size() &&
+              "Replacement policy chose an invalid region.");
+    return indices[victim];
+  }
+
+  /**
+   * Wait until the reconfiguration of any of the regions has ended.
+   */
+  void wait_any_reconf_end() {
+    sc_core::sc_event_or_list reconf_ends;
+    for (size_t i = 0; i < m_regions.size(); i++) {
+      reconf_ends |= m_regions[i].reconf_end_event();
+    }
+    sc_core::wait(reconf_ends);
+  }
+
+  /**
+   * Mark that the module at the given region was used for a request.
+   *
+   * @param i the index of the region
+   * @return the region
+   */
+  region_type &use(size_t i) {
+    m_slots[i].last_use = sc_core::sc_time_stamp();
+    m_slots[i].use_count++;
+    return m_regions[i];
+  }
+
+ public:
+  /**
+   * Construct a pool with the given number of reconfiguration regions.
+   *
+   * @param nm the name of the pool
+   * @param size the number of reconfiguration regions
+   */
+  reconf_region_pool(const sc_core::sc_module_name &nm, size_t size)
+      : sc_core::sc_module(nm), m_regions("region", size), m_slots(size) {
+    sc_assert(size > 0 && "A pool needs at least one region.");
+  }
+
+  /**
+   * Register a module of a specific type at every region of the pool.
+   *
+   * @tparam Module the type of the module that shall be registered
+   * @tparam Args types of optional arguments for the module construction
+   * @param args optional arguments which may be needed to construct the module
+   * @see reconf_region#register_module
+   */
+  template <class Module, typename... Args>
+  void register_module(Args... args) {
+    for (size_t i = 0; i < m_regions.size(); i++) {
+      m_regions[i].template register_module<Module>(args...);
+    }
+  }
+
+  /**
+   * Set the policy that selects which module is replaced on a miss. The default
+   * policy replaces the least recently used module.
+   *
+   * @param policy the new replacement policy
+   */
+  void set_replacement_policy(std::shared_ptr<replacement_policy> policy) {
+    sc_assert(policy != nullptr);
+    m_policy = std::move(policy);
+  }
+
+  /**
+   * Request a module. If the module is configured at one of the regions, this
+   * region is returned immediately. If it is being configured, it is waited for
+   * the reconfiguration to end. Both count as hit. Otherwise a region is
+   * selected and reserved for the module, so that concurrent requests for it
+   * wait for this region instead of configuring another one, and then
+   * reconfigured, which counts as miss. If all regions are reconfigured at the
+   * moment, it is waited for one of them first. The region is returned once the
+   * module is load. If the load is aborted, the reservation is released and the
+   * request starts over.
+   * The replaced module must not have transactions in progress.
+   *
+   * @tparam Module the type of the requested module
+   * @return the region at which the module is configured
+   */
+  template <class Module>
+  region_type &request() {
+    sc_core::sc_time start = sc_core::sc_time_stamp();
+
+    while (true) {
+      size_t i = find_region<Module>();
+      if (i != npos) {
+        if (m_slots[i].reserved || m_regions[i].is_reconfiguring()) {
+          sc_core::wait(m_regions[i].reconf_end_event());
+          continue;
+        }
+        m_hits++;
+        return use(i);
+      }
+
+      i = find_victim<Module>();
+      if (i == npos) {
+        wait_any_reconf_end();
+        continue;
+      }
+
+      NC_REPORT_CONDITIONAL(name(),
+                            "Miss, reconfiguring " << m_regions[i].name())
+      m_slots[i] = slot();
+      m_slots[i].module = m_regions[i].template get_module<Module>().get();
+      m_slots[i].reserved = true;
+      bool loaded = m_regions[i].template configure_module<Module>();
+      m_slots[i].reserved = false;
+      if (!loaded) {
+        NC_REPORT_CONDITIONAL(name(), "Load at " << m_regions[i].name()
+                                                 << " was aborted, retrying.")
+        continue;
+      }
+      m_misses++;
+      m_miss_penalty += sc_core::sc_time_stamp() - start;
+      return use(i);
+    }
+  }
+
+  /**
+   * Get the region with the given index.
+   *
+   * @param i the index of the region
+   * @return the region
+   */
+  region_type &operator[](size_t i) { return m_regions[i]; }
+
+  /**
+   * Get the number of regions in the pool.
+   *
+   * @return the number of regions
+   */
+  size_t size() const { return m_regions.size(); }
+
+  /**
+   * Get the number of requests that were served without reconfiguration.
+   *
+   * @return the number of hits
+   */
+  size_t get_hit_count() const { return m_hits; }
+
+  /**
+   * Get the number of requests that needed a reconfiguration.
+   *
+   * @return the number of misses
+   */
+  size_t get_miss_count() const { return m_misses; }
+
+  /**
+   * Get the ratio of hits to all requests.
+   *
+   * @return the hit rate or 0 if there were no requests yet
+   */
+  double get_hit_rate() const {
+    size_t requests = m_hits + m_misses;
+    return requests == 0 ? 0 : static_cast<double>(m_hits) / requests;
+  }
+
+  /**
+   * Get the total time that missed requests waited until their module was
+   * load.
+   *
+   * @return the total miss penalty
+   */
+  sc_core::sc_time get_miss_penalty() const { return m_miss_penalty; }
+
+  /**
+   * Get the average time that a missed request waited until its module was
+   * load.
+   *
+   * @return the average miss penalty or zero if there were no misses yet
+   */
+  sc_core::sc_time get_average_miss_penalty() const {
+    return m_misses == 0 ? sc_core::SC_ZERO_TIME
+                         : m_miss_penalty / static_cast<double>(m_misses);
+  }
+
+ private:
+  /// @brief Usage of the module that is configured at a region.
+  struct slot {
+    /// @brief the module the region was last reconfigured for by the pool
+    const abstract_module_base *module = nullptr;
+    /// @brief flag indicating whether the region is reserved for the module
+    /// until its reconfiguration ended
+    bool reserved = false;
+    sc_core::sc_time last_use = sc_core::SC_ZERO_TIME;
+    size_t use_count = 0;
+  };
+
+  /// @brief the reconfiguration regions of the pool
+  sc_core::sc_vector<region_type> m_regions;
+  /// @brief the usage of the module configured at each region
+  std::vector<slot> m_slots;
+  /// @brief the policy that selects the region to reconfigure on a miss
+  std::shared_ptr<replacement_policy> m_policy =
+      std::make_shared<lru_replacement_policy>();
+
+  /// @brief number of requests served without reconfiguration
+  size_t m_hits = 0;
+  /// @brief number of requests that needed a reconfiguration
+  size_t m_misses = 0;
+  /// @brief total time that missed requests waited for their module
+  sc_core::sc_time m_miss_penalty = sc_core::SC_ZERO_TIME;
+};
+
+#endif  // REGION_RECONF_REGION_POOL_H_
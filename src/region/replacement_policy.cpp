@@ -0,0 +1,48 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+#include "replacement_policy.h"
+
+size_t lru_replacement_policy::select_victim(
+    const std::vector<replacement_candidate> &candidates) {
+  size_t victim = 0;
+  for (size_t i = 1; i < candidates.size(); i++) {
+    if (candidates[i].last_use < candidates[victim].last_use) victim = i;
+  }
+  return victim;
+}
+
+size_t lfu_replacement_policy::select_victim(
+    const std::vector<replacement_candidate> &candidates) {
+  size_t victim = 0;
+  for (size_t i = 1; i < candidates.size(); i++) {
+    const auto &c = candidates[i];
+    const auto &v = candidates[victim];
+    if (c.use_count < v.use_count ||
+        (c.use_count == v.use_count && c.last_use < v.last_use)) {
+      victim = i;
+    }
+  }
+  return victim;
+}
+
+size_t cost_aware_replacement_policy::select_victim(
+    const std::vector<replacement_candidate> &candidates) {
+  size_t victim = 0;
+  sc_core::sc_time victim_cost =
+      candidates[0].reload_time * static_cast<double>(candidates[0].use_count);
+
+  for (size_t i = 1; i < candidates.size(); i++) {
+    const auto &c = candidates[i];
+    sc_core::sc_time cost = c.reload_time * static_cast<double>(c.use_count);
+    if (cost < victim_cost ||
+        (cost == victim_cost && c.last_use < candidates[victim].last_use)) {
+      victim = i;
+      victim_cost = cost;
+    }
+  }
+  return victim;
+}
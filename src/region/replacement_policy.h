@@ -0,0 +1,81 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+#ifndef REGION_REPLACEMENT_POLICY_H_
+#define REGION_REPLACEMENT_POLICY_H_
+
+#include <cstddef>
+#include <systemc>
+#include <vector>
+
+class abstract_module_base;
+
+/**
+ * Describes one reconfiguration region of a pool that could be reconfigured
+ * to serve a request, as it is seen by a replacement policy.
+ */
+struct replacement_candidate {
+  /// @brief The module that is currently configured at the region.
+  const abstract_module_base *module;
+  /// @brief The time when the configured module was requested the last time.
+  sc_core::sc_time last_use;
+  /// @brief The number of requests the configured module served since it was
+  /// configured at the region.
+  size_t use_count;
+  /// @brief The time needed to configure the module again, once it was
+  /// replaced.
+  sc_core::sc_time reload_time;
+};
+
+/**
+ * Base class for policies that select which module of a reconfiguration region
+ * pool is replaced when a requested module is not configured at any region.
+ */
+class replacement_policy {
+ public:
+  virtual ~replacement_policy() = default;
+
+  /**
+   * Select the region whose module shall be replaced.
+   *
+   * @param candidates the regions that can be reconfigured, never empty
+   * @return the index of the selected region in candidates
+   */
+  virtual size_t select_victim(
+      const std::vector<replacement_candidate> &candidates) = 0;
+};
+
+/**
+ * Replaces the least recently used module.
+ */
+class lru_replacement_policy : public replacement_policy {
+ public:
+  size_t select_victim(
+      const std::vector<replacement_candidate> &candidates) override;
+};
+
+/**
+ * Replaces the least frequently used module. On ties, the least recently used
+ * one is replaced.
+ */
+class lfu_replacement_policy : public replacement_policy {
+ public:
+  size_t select_victim(
+      const std::vector<replacement_candidate> &candidates) override;
+};
+
+/**
+ * Replaces the module whose replacement is expected to cost the least, a.k.a.
+ * the one with the smallest product of use count and reload time. On ties,
+ * the least recently used one is replaced.
+ */
+class cost_aware_replacement_policy : public replacement_policy {
+ public:
+  size_t select_victim(
+      const std::vector<replacement_candidate> &candidates) override;
+};
+
+#endif  // REGION_REPLACEMENT_POLICY_H_
@@ -0,0 +1,110 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+#ifndef REGION_SHADOW_RECONF_REGION_H_
+#define REGION_SHADOW_RECONF_REGION_H_
+
+#include "region/reconf_region.h"
+
+/**
+ * A reconfiguration region with two configuration contexts, as found on
+ * devices with multi-context configuration memory or when two physical regions
+ * share one set of static ports. The next module is loaded into the inactive
+ * (shadow) context while the configured module keeps serving, and both are
+ * swapped without any reconfiguration time afterwards. Apart from that, the
+ * region behaves like any other reconfiguration region and is used with the
+ * same interfaces and adapters.
+ *
+ * @tparam Interface the interface class of the reconfiguration region
+ * @see conf_manager#load_shadow_module, conf_manager#swap_modules
+ */
+template <typename Interface>
+class shadow_reconf_region : public reconf_region<Interface> {
+ public:
+  /**
+   * Construct a reconfiguration region with two configuration contexts.
+   *
+   * @param name the name of this module
+   * @param base_module a pointer to the module that contains the
+   * reconfiguration region or nullptr if it is static
+   */
+  explicit shadow_reconf_region(const sc_core::sc_module_name& name,
+                                abstract_module_base* base_module = nullptr)
+      : reconf_region<Interface>(name, base_module) {
+    this->m_conf.enable_shadow_context();
+  }
+
+  /**
+   * Load a registered module into the shadow context, while the configured
+   * module keeps serving.
+   *
+   * @tparam Module the type of the module to load
+   * @return false if the load failed or was aborted
+   * @note Description copied from conf_manager#load_shadow_module
+   */
+  template <class Module>
+  bool load_shadow_module() {
+    return this->m_conf.template load_shadow_module<Module>();
+  }
+
+  /**
+   * Swap the module in the shadow context with the configured one in zero
+   * time.
+   *
+   * @see conf_manager#swap_modules
+   */
+  void swap_modules() { this->m_conf.swap_modules(); }
+
+  /**
+   * Get a pointer to the module in the shadow context.
+   *
+   * @return instance pointer to the module or nullptr if the shadow context
+   * is empty
+   * @note Description copied from conf_manager#get_shadow_module
+   */
+  auto get_shadow_module() const { return this->m_conf.get_shadow_module(); }
+
+  /**
+   * Get the number of times modules were swapped so far.
+   *
+   * @return the number of swaps
+   */
+  size_t get_swap_count() const { return this->m_conf.get_swap_count(); }
+
+  /**
+   * Get the time spent loading modules into the shadow context so far.
+   *
+   * @return the shadow load time
+   */
+  sc_core::sc_time get_shadow_load_time() const {
+    return this->m_conf.get_shadow_load_time();
+  }
+
+  /**
+   * Get the part of the shadow load time during which a configured module
+   * kept serving.
+   *
+   * @return the hidden load time
+   * @see conf_manager#get_hidden_load_time
+   */
+  sc_core::sc_time get_hidden_load_time() const {
+    return this->m_conf.get_hidden_load_time();
+  }
+
+  /**
+   * Get the fraction of the shadow load time that was overlapped with the
+   * operation of a configured module.
+   *
+   * @return the overlap between 0 and 1, or 0 if nothing was loaded yet
+   */
+  double get_overlap_ratio() const {
+    sc_core::sc_time total = get_shadow_load_time();
+    if (total == sc_core::SC_ZERO_TIME) return 0;
+    return get_hidden_load_time() / total;
+  }
+};
+
+#endif  // REGION_SHADOW_RECONF_REGION_H_
@@ -0,0 +1,494 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+#ifndef REGION_TASK_GRAPH_SCHEDULER_H_
+#define REGION_TASK_GRAPH_SCHEDULER_H_
+
+#include <sysc/kernel/sc_spawn.h>
+
+#include <algorithm>
+#include <deque>
+#include <functional>
+#include <systemc>
+#include <typeindex>
+#include <typeinfo>
+#include <vector>
+
+#include "region/reconf_region.h"
+
+/**
+ * Workload engine that executes a task graph on a set of reconfiguration
+ * regions. Every task is executed by a registered module for a given compute
+ * time on a given amount of input data, edges denote that a task depends on the
+ * results of another one.
+ * Before the simulation starts, the tasks are mapped to the regions by list
+ * scheduling, based on the estimated execution and load times. At run time,
+ * every region configures the modules of its tasks in the planned order, as
+ * soon as its previous task finished, and executes a task once all of its
+ * predecessors finished. For every run, the engine reports the makespan, the
+ * utilization of every region and the total reconfiguration overhead, so that
+ * scheduling policies can be compared on the same graph.
+ * The modules of all tasks need to be registered at all regions.
+ *
+ * @tparam Interface the interface of the reconfiguration regions
+ */
+template <class Interface>
+class task_graph_scheduler : public sc_core::sc_module {
+ public:
+  typedef reconf_region<Interface> region_type;
+
+  /**
+   * Function that executes a task at the region its module is configured at,
+   * e.g. by sending TLM transactions to the region. Gets the region, the
+   * compute time and the size of the input data of the task in bytes.
+   */
+  typedef std::function<void(region_type &, sc_core::sc_time, size_t)>
+      executor_t;
+
+  /// @brief The policy that maps the tasks to the regions.
+  enum class policy {
+    /// @brief tasks in the order of their upward rank, each to the region at
+    /// which it finishes earliest, including the time to reconfigure it
+    heft,
+    /// @brief tasks in topological order, each to the region that is free
+    /// earliest, regardless of the module configured there
+    greedy
+  };
+
+  /**
+   * Statistics of one task.
+   */
+  struct task_stats {
+    /// @brief index of the region the task was mapped to
+    size_t region = 0;
+    /// @brief time at which the execution of the task started
+    sc_core::sc_time start_time;
+    /// @brief time at which the execution of the task finished
+    sc_core::sc_time finish_time;
+    /// @brief flag indicating whether the region was reconfigured for the task
+    bool reconfigured = false;
+    /// @brief flag indicating whether the task finished
+    bool finished = false;
+  };
+
+ private:
+  /**
+   * A task, a.k.a. a node of the graph.
+   */
+  struct task {
+    /// @brief the type of the module that executes the task
+    std::type_index module_type;
+    /// @brief gets the instance of the module at a region
+    std::function<typename conf_manager<Interface>::module_ptr_t(
+        region_type &)>
+        module;
+    /// @brief configures the module at a region, returns false if the load
+    /// was aborted
+    std::function<bool(region_type &)> configure;
+    sc_core::sc_time compute_time;
+    size_t data_size;
+    std::vector<size_t> predecessors;
+    std::vector<size_t> successors;
+    task_stats stats;
+  };
+
+  /**
+   * Get the time to transfer input data to a region.
+   *
+   * @param data_size the size of the data in bytes
+   * @return the transfer time
+   */
+  sc_core::sc_time get_transfer_time(size_t data_size) const {
+    if (m_transfer_speed_mbps == 0) return sc_core::SC_ZERO_TIME;
+    return sc_core::sc_time(
+        static_cast<double>(data_size) / m_transfer_speed_mbps,
+        sc_core::SC_US);
+  }
+
+  /**
+   * Get the estimated time to execute a task at a region where its module is
+   * configured already.
+   *
+   * @param t the task
+   * @return the estimated execution time
+   */
+  sc_core::sc_time get_execution_time(const task &t) const {
+    return get_transfer_time(t.data_size) + t.compute_time;
+  }
+
+  /**
+   * Sort the tasks topologically, tasks that are ready at the same time are
+   * ordered by their id.
+   *
+   * @return the ids of the tasks or an empty vector if the graph has a cycle
+   */
+  std::vector<size_t> topological_order() const {
+    std::vector<size_t> in_degree(m_tasks.size());
+    std::deque<size_t> ready;
+    for (size_t i = 0; i < m_tasks.size(); i++) {
+      in_degree[i] = m_tasks[i].predecessors.size();
+      if (in_degree[i] == 0) ready.push_back(i);
+    }
+
+    std::vector<size_t> order;
+    while (!ready.empty()) {
+      size_t i = ready.front();
+      ready.pop_front();
+      order.push_back(i);
+      for (size_t s : m_tasks[i].successors) {
+        if (--in_degree[s] == 0) ready.push_back(s);
+      }
+    }
+
+    if (order.size() != m_tasks.size()) order.clear();
+    return order;
+  }
+
+  /**
+   * Order the tasks by their upward rank, which is the length of the longest
+   * path from the task to the end of the graph. Tasks with the same rank keep
+   * their topological order, so that every task comes after its predecessors.
+   *
+   * @param topological the tasks in topological order
+   * @return the ids of the tasks by decreasing rank
+   */
+  std::vector<size_t> rank_order(const std::vector<size_t> &topological) const {
+    std::vector<sc_core::sc_time> rank(m_tasks.size());
+    for (auto it = topological.rbegin(); it != topological.rend(); ++it) {
+      sc_core::sc_time longest_successor = sc_core::SC_ZERO_TIME;
+      for (size_t s : m_tasks[*it].successors) {
+        longest_successor = std::max(longest_successor, rank[s]);
+      }
+      rank[*it] = get_execution_time(m_tasks[*it]) + longest_successor;
+    }
+
+    std::vector<size_t> order = topological;
+    std::stable_sort(order.begin(), order.end(),
+                     [&rank](size_t a, size_t b) { return rank[a] > rank[b]; });
+    return order;
+  }
+
+  /**
+   * Map all tasks to the regions according to the policy and fill the plan of
+   * every region.
+   *
+   * @return false if the graph cannot be scheduled
+   */
+  bool plan() {
+    if (m_regions.empty() && !m_tasks.empty()) {
+      SC_REPORT_ERROR(name(), "Cannot schedule tasks without regions.");
+      return false;
+    }
+
+    std::vector<size_t> order = topological_order();
+    if (order.empty() && !m_tasks.empty()) {
+      SC_REPORT_ERROR(name(), "Task graph must not contain cycles.");
+      return false;
+    }
+    if (m_policy == policy::heft) order = rank_order(order);
+
+    // estimated state of every region while the tasks are mapped
+    std::vector<sc_core::sc_time> free_time(m_regions.size());
+    std::vector<const std::type_index *> configured(m_regions.size(), nullptr);
+    std::vector<sc_core::sc_time> finish_time(m_tasks.size());
+
+    for (size_t i : order) {
+      task &t = m_tasks[i];
+      sc_core::sc_time ready = sc_core::SC_ZERO_TIME;
+      for (size_t p : t.predecessors) {
+        ready = std::max(ready, finish_time[p]);
+      }
+
+      size_t best = 0;
+      sc_core::sc_time best_finish;
+      for (size_t r = 0; r < m_regions.size(); r++) {
+        sc_core::sc_time load_time = sc_core::SC_ZERO_TIME;
+        if (configured[r] == nullptr || *configured[r] != t.module_type) {
+          load_time =
+              conf_manager<Interface>::get_load_time(t.module(*m_regions[r]));
+        }
+        sc_core::sc_time finish =
+            std::max(free_time[r] + load_time, ready) + get_execution_time(t);
+
+        bool better = m_policy == policy::heft
+                          ? finish < best_finish
+                          : free_time[r] < free_time[best];
+        if (r == 0 || better) {
+          best = r;
+          best_finish = finish;
+        }
+      }
+
+      t.stats.region = best;
+      free_time[best] = best_finish;
+      configured[best] = &t.module_type;
+      finish_time[i] = best_finish;
+      m_plan[best].push_back(i);
+    }
+    return true;
+  }
+
+  /**
+   * Check whether all predecessors of a task finished.
+   *
+   * @param t the task
+   * @return true if the task can be executed
+   */
+  bool predecessors_finished(const task &t) const {
+    return std::all_of(
+        t.predecessors.begin(), t.predecessors.end(),
+        [this](size_t p) { return m_tasks[p].stats.finished; });
+  }
+
+  /**
+   * Execute the planned tasks of one region in order.
+   *
+   * @param r the index of the region
+   */
+  void run_region(size_t r) {
+    region_type &rr = *m_regions[r];
+    for (size_t i : m_plan[r]) {
+      task &t = m_tasks[i];
+
+      // the next module is configured while its predecessors still run
+      if (rr.get_current_module() != t.module(rr)) {
+        sc_core::sc_time start = sc_core::sc_time_stamp();
+        // the task is planned for this region, so an aborted load is retried
+        while (!t.configure(rr)) {
+          NC_REPORT_CONDITIONAL(name(), "Configuration of task "
+                                            << i << " at " << rr.name()
+                                            << " was aborted, retrying.")
+        }
+        t.stats.reconfigured = true;
+        m_reconfigurations++;
+        m_reconf_overhead += sc_core::sc_time_stamp() - start;
+      }
+
+      while (!predecessors_finished(t)) sc_core::wait(m_task_finished);
+
+      t.stats.start_time = sc_core::sc_time_stamp();
+      m_executor(rr, t.compute_time, t.data_size);
+      t.stats.finish_time = sc_core::sc_time_stamp();
+      t.stats.finished = true;
+      m_busy_time[r] += t.stats.finish_time - t.stats.start_time;
+      m_finished_tasks++;
+
+      NC_REPORT_CONDITIONAL(name(), "Task " << i << " finished at "
+                                            << rr.name())
+      m_task_finished.notify(sc_core::SC_ZERO_TIME);
+    }
+  }
+
+  /**
+   * The process that plans the graph, starts one process per region and waits
+   * for all tasks to finish.
+   */
+  void run() {
+    if (!plan()) return;
+
+    sc_core::sc_time start = sc_core::sc_time_stamp();
+    for (size_t r = 0; r < m_regions.size(); r++) {
+      sc_core::sc_spawn([this, r] { run_region(r); },
+                        sc_core::sc_gen_unique_name("run_region"));
+    }
+
+    while (m_finished_tasks < m_tasks.size()) sc_core::wait(m_task_finished);
+
+    m_makespan = sc_core::sc_time_stamp() - start;
+    m_all_finished.notify(sc_core::SC_ZERO_TIME);
+  }
+
+ public:
+  SC_HAS_PROCESS(task_graph_scheduler);
+
+  /**
+   * Construct a scheduler with the given policy.
+   *
+   * @param nm the name of the scheduler
+   * @param p the policy that maps the tasks to the regions
+   */
+  explicit task_graph_scheduler(const sc_core::sc_module_name &nm,
+                                policy p = policy::heft)
+      : sc_core::sc_module(nm), m_policy(p) {
+    SC_THREAD(run)
+  }
+
+  /**
+   * Add a reconfiguration region that the tasks can be mapped to. The region
+   * must not be used by anyone else. Must be called during elaboration.
+   *
+   * @param rr the reconfiguration region
+   * @return the index of the region
+   */
+  size_t add_region(region_type &rr) {
+    if (sc_core::sc_is_running()) {
+      SC_REPORT_ERROR(name(), "Cannot add region after elaboration.");
+    }
+
+    m_regions.push_back(&rr);
+    m_plan.emplace_back();
+    m_busy_time.push_back(sc_core::SC_ZERO_TIME);
+    return m_regions.size() - 1;
+  }
+
+  /**
+   * Add a task that is executed by the given module, which needs to be
+   * registered at all regions. Must be called during elaboration.
+   *
+   * @tparam Module the type of the module that executes the task
+   * @param compute_time the time the module computes on the input data
+   * @param data_size the size of the input data in bytes
+   * @return the id of the task
+   */
+  template <class Module>
+  size_t add_task(sc_core::sc_time compute_time, size_t data_size = 0) {
+    if (sc_core::sc_is_running()) {
+      SC_REPORT_ERROR(name(), "Cannot add task after elaboration.");
+    }
+
+    m_tasks.push_back(task{
+        typeid(Module),
+        [](region_type &rr) { return rr.template get_module<Module>(); },
+        [](region_type &rr) {
+          return rr.template configure_module<Module>();
+        },
+        compute_time,
+        data_size,
+        {},
+        {},
+        {}});
+    return m_tasks.size() - 1;
+  }
+
+  /**
+   * Add a dependency, so that a task is not executed before another one
+   * finished. Must be called during elaboration.
+   *
+   * @param from the id of the task that needs to finish first
+   * @param to the id of the dependent task
+   */
+  void add_dependency(size_t from, size_t to) {
+    if (sc_core::sc_is_running()) {
+      SC_REPORT_ERROR(name(), "Cannot add dependency after elaboration.");
+    }
+    sc_assert(from < m_tasks.size() && to < m_tasks.size() &&
+              "Unknown task.");
+
+    m_tasks[from].successors.push_back(to);
+    m_tasks[to].predecessors.push_back(from);
+  }
+
+  /**
+   * Set the function that executes a task. The default executor waits for the
+   * transfer of the input data and the compute time.
+   *
+   * @param executor the new executor
+   */
+  void set_executor(executor_t executor) {
+    sc_assert(executor != nullptr);
+    m_executor = std::move(executor);
+  }
+
+  /**
+   * Set the speed at which input data is transferred to a region. It is used
+   * to estimate the execution time of a task and by the default executor.
+   * With a speed of 0, transfers take no time.
+   *
+   * @param mbps the speed in MB/s
+   */
+  void set_transfer_speed_mbps(size_t mbps) { m_transfer_speed_mbps = mbps; }
+
+  /**
+   * Get the statistics of a task.
+   *
+   * @param id the id of the task
+   * @return the statistics
+   */
+  const task_stats &get_task_stats(size_t id) const {
+    return m_tasks.at(id).stats;
+  }
+
+  /**
+   * Get the time from the start of the simulation until all tasks finished.
+   *
+   * @return the makespan or zero if the tasks did not finish yet
+   */
+  sc_core::sc_time get_makespan() const { return m_makespan; }
+
+  /**
+   * Get the fraction of the makespan during which a region executed tasks.
+   *
+   * @param r the index of the region
+   * @return the utilization between 0 and 1 or 0 if the tasks did not finish
+   * yet
+   */
+  double get_utilization(size_t r) const {
+    return m_makespan == sc_core::SC_ZERO_TIME
+               ? 0
+               : m_busy_time.at(r) / m_makespan;
+  }
+
+  /**
+   * Get the total time the regions spent on reconfiguration.
+   *
+   * @return the reconfiguration overhead
+   */
+  sc_core::sc_time get_reconfiguration_overhead() const {
+    return m_reconf_overhead;
+  }
+
+  /**
+   * Get the number of reconfigurations of all regions.
+   *
+   * @return the number of reconfigurations
+   */
+  size_t get_reconfiguration_count() const { return m_reconfigurations; }
+
+  /**
+   * Get the event that is triggered when all tasks finished.
+   *
+   * @return the event
+   */
+  const sc_core::sc_event &all_finished_event() const {
+    return m_all_finished;
+  }
+
+ private:
+  /// @brief the policy that maps the tasks to the regions
+  policy m_policy;
+  /// @brief the speed at which input data is transferred in MB/s
+  size_t m_transfer_speed_mbps = 0;
+  /// @brief the function that executes a task
+  executor_t m_executor = [this](region_type &, sc_core::sc_time compute_time,
+                                 size_t data_size) {
+    sc_core::wait(get_transfer_time(data_size) + compute_time);
+  };
+
+  /// @brief the regions, accessed by their index
+  std::vector<region_type *> m_regions;
+  /// @brief the tasks, accessed by their id
+  std::vector<task> m_tasks;
+  /// @brief the ids of the tasks mapped to every region in execution order
+  std::vector<std::vector<size_t>> m_plan;
+
+  /// @brief number of tasks that finished
+  size_t m_finished_tasks = 0;
+  /// @brief event that is triggered when a task finished
+  sc_core::sc_event m_task_finished;
+  /// @brief event that is triggered when all tasks finished
+  sc_core::sc_event m_all_finished;
+
+  /// @brief time every region spent executing tasks
+  std::vector<sc_core::sc_time> m_busy_time;
+  /// @brief time from the start until all tasks finished
+  sc_core::sc_time m_makespan = sc_core::SC_ZERO_TIME;
+  /// @brief total time spent on reconfiguration
+  sc_core::sc_time m_reconf_overhead = sc_core::SC_ZERO_TIME;
+  /// @brief number of reconfigurations
+  size_t m_reconfigurations = 0;
+};
+
+#endif  // REGION_TASK_GRAPH_SCHEDULER_H_
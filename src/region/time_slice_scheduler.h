@@ -0,0 +1,294 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+#ifndef REGION_TIME_SLICE_SCHEDULER_H_
+#define REGION_TIME_SLICE_SCHEDULER_H_
+
+#include <algorithm>
+#include <deque>
+#include <functional>
+#include <systemc>
+#include <vector>
+
+#include "region/reconf_region.h"
+
+/**
+ * Scheduler that time-shares one reconfiguration region among several
+ * long-running hardware tasks. Every task is a registered module that needs to
+ * be configured for a given execution time. The scheduler runs the ready tasks
+ * in time slices, either in round-robin order or by priority, and preempts a
+ * task at the end of its slice if another task is ready. Preemption saves the
+ * task's context and reconfigures the region, the context is restored when the
+ * task runs again.
+ * For every task, the scheduler records its response time and throughput.
+ *
+ * @tparam Interface the interface of the reconfiguration region
+ * @see conf_manager#switch_module
+ */
+template <class Interface>
+class time_slice_scheduler : public sc_core::sc_module {
+ public:
+  /// @brief The order in which ready tasks are run.
+  enum class policy {
+    /// @brief all ready tasks run in turn
+    round_robin,
+    /// @brief the ready task with the highest priority runs, tasks with the
+    /// same priority run in turn
+    priority
+  };
+
+  /**
+   * Statistics of one task.
+   */
+  struct task_stats {
+    /// @brief time at which the task became ready
+    sc_core::sc_time release_time;
+    /// @brief time at which the task finished its execution
+    sc_core::sc_time finish_time;
+    /// @brief time that the task was executed so far
+    sc_core::sc_time executed_time;
+    /// @brief number of times the task was configured at the region
+    size_t configurations = 0;
+    /// @brief flag indicating whether the task finished
+    bool finished = false;
+
+    /**
+     * Get the time from the release of the task to its finish.
+     *
+     * @return the response time
+     */
+    sc_core::sc_time response_time() const {
+      return finish_time - release_time;
+    }
+
+    /**
+     * Get the throughput of the task relative to running it alone on a
+     * dedicated region, a.k.a. its execution time over its response time.
+     *
+     * @return the throughput between 0 and 1
+     */
+    double throughput() const { return executed_time / response_time(); }
+  };
+
+ private:
+  /**
+   * A task, a.k.a. a module that needs to run for some time.
+   */
+  struct task {
+    /// @brief the module that executes the task
+    typename conf_manager<Interface>::module_ptr_t module;
+    /// @brief configures the module while saving and restoring contexts,
+    /// returns false if the load was aborted
+    std::function<bool()> switch_to;
+    sc_core::sc_time execution_time;
+    int priority;
+    bool released = false;
+    task_stats stats;
+  };
+
+  /**
+   * Move all tasks whose release time has passed into the ready queue.
+   */
+  void release_tasks() {
+    for (size_t i = 0; i < m_tasks.size(); i++) {
+      task &t = m_tasks[i];
+      if (!t.released && t.stats.release_time <= sc_core::sc_time_stamp()) {
+        t.released = true;
+        m_ready.push_back(i);
+      }
+    }
+  }
+
+  /**
+   * Take the next task to run from the ready queue.
+   *
+   * @return the index of the task
+   */
+  size_t take_next_task() {
+    auto next = m_ready.begin();
+    if (m_policy == policy::priority) {
+      // the first one of the highest priority, so that equal ones take turns
+      for (auto it = m_ready.begin(); it != m_ready.end(); ++it) {
+        if (m_tasks[*it].priority > m_tasks[*next].priority) next = it;
+      }
+    }
+
+    size_t i = *next;
+    m_ready.erase(next);
+    return i;
+  }
+
+  /**
+   * Get the time at which the next task that was not released yet will be
+   * released.
+   *
+   * @return the next release time or SC_ZERO_TIME if all tasks were released
+   */
+  sc_core::sc_time next_release_time() const {
+    sc_core::sc_time next = sc_core::SC_ZERO_TIME;
+    for (const auto &t : m_tasks) {
+      if (!t.released && (next == sc_core::SC_ZERO_TIME ||
+                          t.stats.release_time < next)) {
+        next = t.stats.release_time;
+      }
+    }
+    return next;
+  }
+
+  /**
+   * The scheduling process, which runs the tasks slice by slice until all of
+   * them finished.
+   */
+  void schedule() {
+    while (true) {
+      release_tasks();
+
+      if (m_ready.empty()) {
+        sc_core::sc_time next = next_release_time();
+        if (next == sc_core::SC_ZERO_TIME) break;
+        sc_core::wait(next - sc_core::sc_time_stamp());
+        continue;
+      }
+
+      size_t i = take_next_task();
+      task &t = m_tasks[i];
+
+      if (m_rr.get_current_module() != t.module) {
+        sc_core::sc_time start = sc_core::sc_time_stamp();
+        bool configured = t.switch_to();
+        m_switch_overhead += sc_core::sc_time_stamp() - start;
+
+        if (!configured) {
+          // the task did not run, so it stays ready behind the others
+          NC_REPORT_CONDITIONAL(name(), "Configuration of task "
+                                            << t.module->name()
+                                            << " was aborted.")
+          release_tasks();
+          m_ready.push_back(i);
+          continue;
+        }
+        t.stats.configurations++;
+      }
+
+      sc_core::sc_time run =
+          std::min(m_slice, t.execution_time - t.stats.executed_time);
+      sc_core::wait(run);
+      t.stats.executed_time += run;
+
+      // tasks released during the slice queue up before the preempted task
+      release_tasks();
+
+      if (t.stats.executed_time < t.execution_time) {
+        m_ready.push_back(i);
+      } else {
+        t.stats.finished = true;
+        t.stats.finish_time = sc_core::sc_time_stamp();
+        NC_REPORT_CONDITIONAL(name(), "Task " << t.module->name()
+                                              << " finished.")
+        // the context of a finished task does not need to be saved
+        m_rr.unload_module();
+      }
+    }
+
+    m_all_finished.notify(sc_core::SC_ZERO_TIME);
+  }
+
+ public:
+  SC_HAS_PROCESS(time_slice_scheduler);
+
+  /**
+   * Construct a scheduler for the given reconfiguration region.
+   *
+   * @param nm the name of the scheduler
+   * @param rr the reconfiguration region that is time-shared
+   * @param slice the length of a time slice
+   * @param p the order in which ready tasks are run
+   */
+  time_slice_scheduler(const sc_core::sc_module_name &nm,
+                       reconf_region<Interface> &rr, sc_core::sc_time slice,
+                       policy p = policy::round_robin)
+      : sc_core::sc_module(nm), m_rr(rr), m_slice(slice), m_policy(p) {
+    sc_assert(slice > sc_core::SC_ZERO_TIME &&
+              "Time slice has to be larger than zero.");
+    SC_THREAD(schedule)
+  }
+
+  /**
+   * Add a task that is executed by the given module, which needs to be
+   * registered at the reconfiguration region already. Every module can execute
+   * one task. Must be called during elaboration.
+   *
+   * @tparam Module the type of the module that executes the task
+   * @param execution_time the time the module needs to be configured to
+   * finish the task
+   * @param priority the priority of the task, higher values are more important
+   * @param release_time the time at which the task becomes ready
+   * @return the id of the task
+   */
+  template <class Module>
+  size_t add_task(sc_core::sc_time execution_time, int priority = 0,
+                  sc_core::sc_time release_time = sc_core::SC_ZERO_TIME) {
+    if (sc_core::sc_is_running()) {
+      SC_REPORT_ERROR(name(), "Cannot add task after elaboration.");
+    }
+
+    task t;
+    t.module = m_rr.template get_module<Module>();
+    t.switch_to = [this] { return m_rr.template switch_module<Module>(); };
+    t.execution_time = execution_time;
+    t.priority = priority;
+    t.stats.release_time = release_time;
+    m_tasks.push_back(std::move(t));
+    return m_tasks.size() - 1;
+  }
+
+  /**
+   * Get the statistics of a task.
+   *
+   * @param id the id of the task
+   * @return the statistics
+   */
+  const task_stats &get_task_stats(size_t id) const {
+    return m_tasks.at(id).stats;
+  }
+
+  /**
+   * Get the total time that was spent on reconfiguration and context
+   * transfers.
+   *
+   * @return the switch overhead
+   */
+  sc_core::sc_time get_switch_overhead() const { return m_switch_overhead; }
+
+  /**
+   * Get the event that is triggered when all tasks finished.
+   *
+   * @return the event
+   */
+  const sc_core::sc_event &all_finished_event() const {
+    return m_all_finished;
+  }
+
+ private:
+  /// @brief the reconfiguration region that is time-shared
+  reconf_region<Interface> &m_rr;
+  /// @brief the length of a time slice
+  sc_core::sc_time m_slice;
+  /// @brief the order in which ready tasks are run
+  policy m_policy;
+
+  /// @brief all tasks, accessed by their id
+  std::vector<task> m_tasks;
+  /// @brief ids of the released, unfinished tasks that do not run currently
+  std::deque<size_t> m_ready;
+
+  /// @brief total time spent on reconfiguration and context transfers
+  sc_core::sc_time m_switch_overhead = sc_core::SC_ZERO_TIME;
+  /// @brief event that is triggered when all tasks finished
+  sc_core::sc_event m_all_finished;
+};
+
+#endif  // REGION_TIME_SLICE_SCHEDULER_H_
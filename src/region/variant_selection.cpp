@@ -0,0 +1,24 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+#include "variant_selection.h"
+
+size_t min_completion_time_policy::select(
+    const std::vector<variant_candidate> &candidates, double work) {
+  size_t best = 0;
+  sc_core::sc_time best_time = candidates[0].completion_time(work);
+
+  for (size_t i = 1; i < candidates.size(); i++) {
+    sc_core::sc_time time = candidates[i].completion_time(work);
+    if (time < best_time ||
+        (time == best_time && candidates[i].configured)) {
+      best = i;
+      best_time = time;
+    }
+  }
+
+  return best;
+}
@@ -0,0 +1,85 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+#ifndef REGION_VARIANT_SELECTION_H_
+#define REGION_VARIANT_SELECTION_H_
+
+#include <cstddef>
+#include <systemc>
+#include <vector>
+
+class abstract_module_base;
+
+/**
+ * Describes one variant of a function, a.k.a. one of the modules that
+ * implement it, as it is seen by a variant selection policy when the function
+ * is requested.
+ */
+struct variant_candidate {
+  /// @brief The module that implements the variant.
+  const abstract_module_base *module;
+  /// @brief The throughput of the variant in work units per microsecond.
+  double throughput_per_us;
+  /// @brief The time needed to configure the variant, zero if it is already
+  /// configured.
+  sc_core::sc_time reconf_time;
+  /// @brief The time the variant is still busy with the work of earlier
+  /// requests, which is only non-zero if it is configured.
+  sc_core::sc_time busy_time;
+  /// @brief The time the configured module is still busy with the work of
+  /// earlier requests, whose remaining work is dropped if this variant is
+  /// configured instead. Only non-zero if the variant is not configured.
+  sc_core::sc_time preempted_time;
+  /// @brief Flag indicating whether the variant is currently configured.
+  bool configured;
+
+  /**
+   * Get the time the variant needs to complete the given amount of work,
+   * including its reconfiguration and the work it is still busy with. The
+   * preempted time is not included, since the variant does not wait for the
+   * preempted work.
+   *
+   * @param work the amount of work in work units
+   * @return the expected completion time
+   */
+  sc_core::sc_time completion_time(double work) const {
+    return busy_time + reconf_time +
+           sc_core::sc_time(work / throughput_per_us, sc_core::SC_US);
+  }
+};
+
+/**
+ * Base class for policies that select one of the variants of a function when
+ * the function is requested at a reconfiguration region.
+ */
+class variant_selection_policy {
+ public:
+  virtual ~variant_selection_policy() = default;
+
+  /**
+   * Select the variant that shall be configured.
+   *
+   * @param candidates the variants of the requested function, never empty
+   * @param work the amount of work that the function shall perform
+   * @return the index of the selected variant in candidates
+   */
+  virtual size_t select(const std::vector<variant_candidate> &candidates,
+                        double work) = 0;
+};
+
+/**
+ * Default policy, which selects the variant with the minimal expected
+ * completion time, a.k.a. busy time plus reconfiguration time plus processing
+ * time for the requested work. On ties, an already configured variant is
+ * preferred. The work that a variant preempts is not taken into account.
+ */
+class min_completion_time_policy : public variant_selection_policy {
+ public:
+  size_t select(const std::vector<variant_candidate> &candidates,
+                double work) override;
+};
+
+#endif  // REGION_VARIANT_SELECTION_H_
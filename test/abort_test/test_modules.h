@@ -0,0 +1,34 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+
+#ifndef ABORT_TEST_MODULES_H
+#define ABORT_TEST_MODULES_H
+
+#include "test_fixture.h"
+
+/**
+ * Module that counts its activations.
+ *
+ * @tparam BitstreamKiB the size of the bitstream in KiB
+ */
+template <size_t BitstreamKiB>
+NC_MODULE(counting_module, filter_interface) {
+ public:
+  size_t activations = 0;
+
+  NC_CTOR(counting_module, filter_interface) {}
+
+  TEST_BITSTREAM_KIB(BitstreamKiB)
+
+ protected:
+  void on_activate() override { activations++; }
+};
+
+typedef counting_module<64> background_module;
+typedef counting_module<16> urgent_module;
+
+#endif  // ABORT_TEST_MODULES_H
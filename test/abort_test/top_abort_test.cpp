@@ -0,0 +1,80 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+
+#include <systemc>
+
+#include "test_modules.h"
+
+using namespace sc_core;
+
+struct top : public sc_module {
+  reconf_region<filter_interface> rz{"rz"};
+  sc_signal<int> output_signal;
+  size_t progress_events = 0;
+  sc_time urgent_loaded;
+
+  SC_HAS_PROCESS(top);
+  explicit top(const sc_module_name& nm) : sc_module(nm) {
+    rz.register_module<background_module>();
+    rz.register_module<urgent_module>();
+    // 16 frames of 4 KiB, each written in 4 us
+    rz.set_frame_model(16, 4 * 1024);
+    rz.output.bind(output_signal);
+
+    SC_THREAD(verify)
+    SC_THREAD(preempt)
+  }
+
+  /**
+   * Abort the load of the background module after a quarter of it was
+   * written, and load the urgent module instead.
+   */
+  void preempt() {
+    while (rz.get_load_progress() < 0.25) {
+      wait(rz.load_progress_event());
+      progress_events++;
+    }
+    sc_assert(sc_time_stamp() == sc_time(16, SC_US));
+    sc_assert(rz.abort_configuration());
+    sc_assert(!rz.abort_configuration());
+
+    wait(rz.reconf_end_event());
+    sc_assert(rz.configure_module<urgent_module>());
+    urgent_loaded = sc_time_stamp();
+  }
+
+  void verify() {
+    sc_assert(!rz.abort_configuration());
+
+    // returns false as soon as the load was aborted
+    sc_assert(!rz.configure_module<background_module>());
+    sc_assert(sc_time_stamp() == sc_time(16, SC_US));
+    sc_assert(progress_events == 4);
+    sc_assert(rz.get_current_module() == nullptr);
+    sc_assert(!rz.is_reconfiguring());
+    sc_assert(rz.get_module<background_module>()->activations == 0);
+
+    // the urgent module is load right after the abort
+    while (rz.get_current_module() == nullptr || rz.is_reconfiguring()) {
+      wait(rz.reconf_end_event());
+    }
+    sc_assert(urgent_loaded == sc_time(32, SC_US));
+    sc_assert(rz.get_current_module() == rz.get_module<urgent_module>());
+    sc_assert(rz.get_module<urgent_module>()->activations == 1);
+    sc_assert(rz.get_load_progress() == 1);
+
+    NC_REPORT_TIMED_INFO(name(), "Load was aborted for an urgent module.")
+  }
+};
+
+int sc_main(int argc, char** argv) {
+  top t("top");
+
+  sc_start(1, SC_MS);
+
+  return 0;
+}
@@ -0,0 +1,25 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+
+#ifndef ARENA_TEST_FIFO_INTERFACE_H
+#define ARENA_TEST_FIFO_INTERFACE_H
+
+#include <systemc>
+
+#include "nc_interface.h"
+#include "region/reconf_region.h"
+
+NC_INTERFACE(fifo_interface) {
+  sc_core::sc_in<int> input;
+  sc_core::sc_out<int> output;
+
+  NC_LOAD_SPEED_MBPS(1024);
+
+  NC_INTERFACE_REGISTER(fifo_interface, input, output);
+};
+
+#endif  // ARENA_TEST_FIFO_INTERFACE_H
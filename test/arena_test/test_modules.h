@@ -0,0 +1,64 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+
+#ifndef ARENA_TEST_MODULES_H
+#define ARENA_TEST_MODULES_H
+
+#include <deque>
+
+#include "fifo_interface.h"
+
+/**
+ * Delays its input by a number of samples using a FIFO that lives in the
+ * module's arena.
+ */
+NC_MODULE(delay_module, fifo_interface) {
+ public:
+  typedef std::deque<int, nc_arena_allocator<int>> fifo_t;
+
+  static constexpr size_t depth = 4;
+
+  fifo_t* fifo = nullptr;
+
+  SC_HAS_PROCESS(delay_module);
+  NC_CTOR(delay_module, fifo_interface) {
+    NC_METHOD(shift);
+    sensitive << input;
+    dont_initialize();
+  }
+
+  size_t get_arena_size_bytes() const override { return 256 * 1024; }
+
+  void on_activate() override {
+    fifo = arena().create<fifo_t>(depth, 0, nc_arena_allocator<int>(arena()));
+    NC_REPORT_TIMED_INFO(name(), "was load.")
+  }
+
+  void on_deactivate() override { fifo = nullptr; }
+
+  void shift() {
+    fifo->push_back(input.read());
+    output.write(fifo->front());
+    fifo->pop_front();
+  }
+};
+
+/**
+ * Forwards its input without allocating anything.
+ */
+NC_MODULE(wire_module, fifo_interface) {
+ public:
+  SC_HAS_PROCESS(wire_module);
+  NC_CTOR(wire_module, fifo_interface) {
+    NC_METHOD(forward);
+    sensitive << input;
+  }
+
+  void forward() { output.write(input.read()); }
+};
+
+#endif  // ARENA_TEST_MODULES_H
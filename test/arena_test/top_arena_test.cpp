@@ -0,0 +1,73 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+
+#include <systemc>
+
+#include "test_modules.h"
+
+using namespace sc_core;
+
+struct top : public sc_module {
+  reconf_region<fifo_interface> rz{"rz"};
+  sc_signal<int> in_signal, out_signal;
+
+  SC_HAS_PROCESS(top);
+  explicit top(const sc_module_name& nm) : sc_module(nm) {
+    rz.register_module<delay_module>();
+    rz.register_module<wire_module>();
+
+    rz.input.bind(in_signal);
+    rz.output.bind(out_signal);
+
+    SC_THREAD(verify)
+  }
+
+  void verify() {
+    auto delay = rz.get_module<delay_module>();
+    auto wire = rz.get_module<wire_module>();
+
+    // nothing is held before the module is configured
+    sc_assert(delay->get_arena_bytes() == 0);
+
+    rz.configure_module<delay_module>();
+    sc_assert(delay->get_arena_bytes() >= delay->get_arena_size_bytes());
+
+    for (int i = 1; i <= 8; i++) {
+      in_signal.write(i);
+      wait(1, SC_NS);
+      int expected = i > static_cast<int>(delay_module::depth)
+                         ? i - static_cast<int>(delay_module::depth)
+                         : 0;
+      sc_assert(out_signal.read() == expected);
+    }
+
+    // the arena is released together with the module
+    rz.configure_module<wire_module>();
+    sc_assert(delay->get_arena_bytes() == 0);
+    sc_assert(wire->get_arena_bytes() == 0);
+
+    in_signal.write(42);
+    wait(1, SC_NS);
+    sc_assert(out_signal.read() == 42);
+
+    // a new fifo is allocated on reconfiguration
+    rz.configure_module<delay_module>();
+    in_signal.write(1);
+    wait(1, SC_NS);
+    sc_assert(out_signal.read() == 0);
+
+    NC_REPORT_TIMED_INFO(name(), "Arena followed the configuration state.")
+  }
+};
+
+int sc_main(int argc, char** argv) {
+  top t("top");
+
+  sc_start(100, SC_US);
+
+  return 0;
+}
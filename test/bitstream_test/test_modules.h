@@ -0,0 +1,30 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+
+#ifndef BITSTREAM_TEST_MODULES_H
+#define BITSTREAM_TEST_MODULES_H
+
+#include "test_fixture.h"
+
+/**
+ * Module that does not declare its bitstream size, so that it is taken from
+ * the bitstream registry. The modules only differ in their type, so that
+ * several of them can be registered at a region.
+ *
+ * @tparam Id the id of the module
+ */
+template <int Id>
+NC_MODULE(plain_module, filter_interface) {
+ public:
+  NC_CTOR(plain_module, filter_interface) {}
+};
+
+typedef plain_module<0> bit_module;
+typedef plain_module<1> bin_module;
+typedef plain_module<2> unbound_module;
+
+#endif  // BITSTREAM_TEST_MODULES_H
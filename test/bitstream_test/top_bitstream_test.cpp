@@ -0,0 +1,163 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <systemc>
+#include <vector>
+
+#include "modules/nc_bitstream_registry.h"
+#include "test_modules.h"
+
+using namespace sc_core;
+
+/// @brief Type that a bitstream is bound to only to check its metadata.
+struct checked_bitstream {};
+/// @brief Types that invalid bitstreams are bound to.
+struct empty_bitstream {};
+struct empty_payload_bitstream {};
+
+/**
+ * Append a 32 bit word in big endian byte order.
+ */
+void append_word(std::vector<unsigned char>& data, uint32_t word) {
+  for (int i = 3; i >= 0; i--) data.push_back((word >> (8 * i)) & 0xff);
+}
+
+/**
+ * Write the test bitstream files into the given directory:
+ * - a .bit file with 1 KiB of configuration data that writes two frames,
+ * - a .bin file with 4 KiB of raw data,
+ * - a .bin file with the standard CRC-32 check input,
+ * - an empty .bin file and a .bit file without configuration data.
+ */
+void write_bitstreams(const std::filesystem::path& dir) {
+  std::vector<unsigned char> config;
+  append_word(config, 0xffffffff);  // dummy
+  append_word(config, 0xaa995566);  // sync
+  append_word(config, 0x30004000);  // type 1 write to FDRI
+  append_word(config, 0x50000000 | 2 * 101);  // type 2 write of two frames
+  for (uint32_t i = 0; i < 2 * 101; i++) append_word(config, i);
+  while (config.size() < 1024) append_word(config, 0x20000000);  // no-op
+
+  std::vector<unsigned char> bit = {0x00, 0x09, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f,
+                                    0xf0, 0x0f, 0xf0, 0x00, 0x00, 0x01};
+  std::string design = "design";
+  bit.push_back('a');
+  bit.push_back(0);
+  bit.push_back(design.size());
+  bit.insert(bit.end(), design.begin(), design.end());
+  bit.push_back('e');
+  std::vector<unsigned char> empty_payload = bit;
+  append_word(empty_payload, 0);
+  append_word(bit, config.size());
+  bit.insert(bit.end(), config.begin(), config.end());
+
+  std::ofstream(dir / "bit_module.bit", std::ios::binary)
+      .write(reinterpret_cast<const char*>(bit.data()), bit.size());
+  std::ofstream(dir / "bin_module.bin", std::ios::binary)
+      << std::string(4096, '\0');
+  std::ofstream(dir / "check.bin", std::ios::binary) << "123456789";
+  std::ofstream(dir / "empty.bin", std::ios::binary);
+  std::ofstream(dir / "empty_payload.bit", std::ios::binary)
+      .write(reinterpret_cast<const char*>(empty_payload.data()),
+             empty_payload.size());
+}
+
+/**
+ * Check that files without configuration data are reported and not bound.
+ */
+void check_invalid_bitstreams(const std::filesystem::path& dir) {
+  nc_bitstream_registry registry;
+  registry.add<empty_bitstream>((dir / "empty.bin").string());
+  registry.add<empty_payload_bitstream>((dir / "empty_payload.bit").string());
+
+  sc_report_handler::set_actions("nc_bitstream_registry", SC_ERROR,
+                                 SC_DISPLAY);
+  registry.load();
+  sc_assert(sc_report_handler::get_count("nc_bitstream_registry") == 2);
+  sc_report_handler::set_actions("nc_bitstream_registry", SC_ERROR,
+                                 SC_DEFAULT_ERROR_ACTIONS);
+
+  sc_assert(registry.find<empty_bitstream>() == nullptr);
+  sc_assert(registry.find<empty_payload_bitstream>() == nullptr);
+}
+
+struct top : public sc_module {
+  reconf_region<filter_interface> rz{"rz"};
+  sc_signal<int> output_signal;
+
+  SC_HAS_PROCESS(top);
+  top(const sc_module_name& nm, const std::filesystem::path& dir)
+      : sc_module(nm) {
+    auto& registry = nc_bitstream_registry::global();
+    registry.enable_checksums();
+    registry.add<bit_module>((dir / "bit_module.bit").string());
+    registry.add<bin_module>((dir / "bin_module.bin").string());
+    registry.add<checked_bitstream>((dir / "check.bin").string());
+    registry.load();
+
+    rz.register_module<bit_module>();
+    rz.register_module<bin_module>();
+    rz.register_module<unbound_module>();
+    rz.output.bind(output_signal);
+
+    SC_THREAD(verify)
+  }
+
+  /**
+   * Configure a module and check the time it took.
+   */
+  template <class Module>
+  void check_load(int expected_us) {
+    sc_time start = sc_time_stamp();
+    rz.configure_module<Module>();
+    sc_assert(sc_time_stamp() - start == sc_time(expected_us, SC_US));
+  }
+
+  void verify() {
+    auto& registry = nc_bitstream_registry::global();
+
+    // the header of the .bit file is not part of the configuration data
+    const nc_bitstream_info* bit = registry.find<bit_module>();
+    sc_assert(bit != nullptr);
+    sc_assert(bit->size_bytes == 1024);
+    sc_assert(bit->frame_count == 2);
+    sc_assert(bit->data[4] == 0xaa);
+
+    const nc_bitstream_info* check = registry.find<checked_bitstream>();
+    sc_assert(check->size_bytes == 9);
+    sc_assert(check->frame_count == 0);
+    sc_assert(check->checksum == 0xcbf43926);
+
+    sc_assert(registry.find<unbound_module>() == nullptr);
+
+    // the load times follow from the sizes of the files
+    check_load<bit_module>(1);
+    check_load<bin_module>(4);
+    check_load<unbound_module>(1);
+
+    NC_REPORT_TIMED_INFO(name(), "Bitstream sizes were taken from files.")
+  }
+};
+
+int sc_main(int argc, char** argv) {
+  std::filesystem::path dir =
+      std::filesystem::temp_directory_path() / "nc_bitstream_test";
+  std::filesystem::create_directories(dir);
+  write_bitstreams(dir);
+  check_invalid_bitstreams(dir);
+
+  top t("top", dir);
+
+  sc_start(1, SC_MS);
+
+  std::filesystem::remove_all(dir);
+  return 0;
+}
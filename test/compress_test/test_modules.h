@@ -0,0 +1,47 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+
+#ifndef COMPRESS_TEST_MODULES_H
+#define COMPRESS_TEST_MODULES_H
+
+#include <string>
+
+#include "test_fixture.h"
+
+/**
+ * Module whose 64 KiB bitstream is run-length encoded to 16 KiB.
+ */
+NC_MODULE(rle_module, filter_interface) {
+ public:
+  NC_CTOR(rle_module, filter_interface) {}
+
+  TEST_BITSTREAM_KIB(64)
+
+  size_t get_compressed_bitstream_size_bytes() const override {
+    return 16 * 1024;
+  }
+
+  std::string get_compression_scheme() const override { return "rle"; }
+};
+
+/**
+ * Module whose 64 KiB bitstream is compressed with another scheme.
+ */
+NC_MODULE(lz_module, filter_interface) {
+ public:
+  NC_CTOR(lz_module, filter_interface) {}
+
+  TEST_BITSTREAM_KIB(64)
+
+  size_t get_compressed_bitstream_size_bytes() const override {
+    return 16 * 1024;
+  }
+
+  std::string get_compression_scheme() const override { return "lz"; }
+};
+
+#endif  // COMPRESS_TEST_MODULES_H
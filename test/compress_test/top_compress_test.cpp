@@ -0,0 +1,76 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+
+#include <systemc>
+
+#include "test_modules.h"
+
+using namespace sc_core;
+
+struct top : public sc_module {
+  // transfers at 1024 MB/s, decompressors with 2048 MB/s and 8192 MB/s
+  reconf_region<filter_interface> rz_slow{"rz_slow"}, rz_fast{"rz_fast"},
+      rz_plain{"rz_plain"};
+  sc_signal<int> slow_signal, fast_signal, plain_signal;
+
+  SC_HAS_PROCESS(top);
+  explicit top(const sc_module_name& nm) : sc_module(nm) {
+    rz_slow.register_module<rle_module>();
+    rz_slow.register_module<lz_module>();
+    rz_slow.set_decompressor("rle", 2048);
+    rz_slow.output.bind(slow_signal);
+
+    rz_fast.register_module<rle_module>();
+    rz_fast.set_decompressor("rle", 8192);
+    rz_fast.output.bind(fast_signal);
+
+    rz_plain.register_module<rle_module>();
+    rz_plain.output.bind(plain_signal);
+
+    SC_THREAD(verify)
+  }
+
+  /**
+   * Configure a module and check the time it took.
+   */
+  template <class Module>
+  void check_load(reconf_region<filter_interface>& rr, int expected_us) {
+    sc_time start = sc_time_stamp();
+    rr.configure_module<Module>();
+    sc_assert(sc_time_stamp() - start == sc_time(expected_us, SC_US));
+  }
+
+  void verify() {
+    sc_assert(rz_slow.get_effective_load_speed_MBps() == 0);
+
+    // bound by the decompression of 64 KiB
+    check_load<rle_module>(rz_slow, 32);
+    sc_assert(rz_slow.get_effective_load_speed_MBps() == 2048);
+
+    // the decompressor does not support the scheme
+    check_load<lz_module>(rz_slow, 64);
+    sc_assert(rz_slow.get_effective_load_speed_MBps() == 128 * 1024 / 96.0);
+
+    // bound by the transfer of 16 KiB
+    check_load<rle_module>(rz_fast, 16);
+    sc_assert(rz_fast.get_effective_load_speed_MBps() == 4096);
+
+    // without decompressor, the uncompressed bitstream is transferred
+    check_load<rle_module>(rz_plain, 64);
+    sc_assert(rz_plain.get_effective_load_speed_MBps() == 1024);
+
+    NC_REPORT_TIMED_INFO(name(), "Compressed bitstreams were load.")
+  }
+};
+
+int sc_main(int argc, char** argv) {
+  top t("top");
+
+  sc_start(1, SC_MS);
+
+  return 0;
+}
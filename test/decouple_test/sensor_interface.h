@@ -0,0 +1,33 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+
+#ifndef DECOUPLE_TEST_SENSOR_INTERFACE_H
+#define DECOUPLE_TEST_SENSOR_INTERFACE_H
+
+#include <systemc>
+
+#include "nc_interface.h"
+#include "region/reconf_region.h"
+
+/// @brief Provides the value of the ratio while no module is coupled.
+struct neutral_ratio {
+  static double get_value() { return 0.5; }
+};
+
+NC_INTERFACE(sensor_interface) {
+  sc_core::sc_out<sc_dt::sc_uint<8>> count;
+  nc_out<int, nc_decouple_hold_last> level;
+  nc_out<sc_dt::sc_lv<8>, nc_decouple_high_z> bus;
+  nc_out<int, nc_decouple_constant<-1>> status;
+  nc_out<double, nc_decouple_with<neutral_ratio>> ratio;
+
+  NC_LOAD_SPEED_MBPS(1024);
+
+  NC_INTERFACE_REGISTER(sensor_interface, count, level, bus, status, ratio);
+};
+
+#endif  // DECOUPLE_TEST_SENSOR_INTERFACE_H
@@ -0,0 +1,42 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+
+#ifndef DECOUPLE_TEST_MODULES_H
+#define DECOUPLE_TEST_MODULES_H
+
+#include "sensor_interface.h"
+#include "test_fixture.h"
+
+/**
+ * Sensor that drives all outputs once it is activated.
+ *
+ * @tparam Level the level and count that the sensor drives
+ * @tparam BitstreamKiB the size of the bitstream in KiB
+ */
+template <int Level, size_t BitstreamKiB>
+NC_MODULE(sensor, sensor_interface) {
+ public:
+  NC_CTOR(sensor, sensor_interface) {
+    // runs once on activation
+    NC_METHOD(drive)
+  }
+
+  TEST_BITSTREAM_KIB(BitstreamKiB)
+
+  void drive() {
+    count.write(Level);
+    level.write(Level);
+    bus.write("10101010");
+    status.write(0);
+    ratio.write(1.0);
+  }
+};
+
+typedef sensor<7, 1> first_sensor;
+typedef sensor<9, 2> second_sensor;
+
+#endif  // DECOUPLE_TEST_MODULES_H
@@ -0,0 +1,84 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+
+#include <systemc>
+
+#include "test_modules.h"
+
+using namespace sc_core;
+
+struct top : public sc_module {
+  reconf_region<sensor_interface> rz{"rz"};
+  sc_signal<sc_dt::sc_uint<8>> count_signal;
+  sc_signal<int> level_signal;
+  sc_signal<sc_dt::sc_lv<8>> bus_signal;
+  sc_signal<int> status_signal;
+  sc_signal<double> ratio_signal;
+
+  size_t level_changes = 0;
+
+  SC_HAS_PROCESS(top);
+  explicit top(const sc_module_name& nm) : sc_module(nm) {
+    rz.register_module<first_sensor>();
+    rz.register_module<second_sensor>();
+    rz.count.bind(count_signal);
+    rz.level.bind(level_signal);
+    rz.bus.bind(bus_signal);
+    rz.status.bind(status_signal);
+    rz.ratio.bind(ratio_signal);
+
+    SC_METHOD(count_level_changes)
+    sensitive << level_signal;
+    dont_initialize();
+
+    SC_THREAD(verify)
+  }
+
+  void count_level_changes() { level_changes++; }
+
+  void verify() {
+    const sc_dt::sc_lv<8> driven("10101010");
+    const sc_dt::sc_lv<8> high_z("ZZZZZZZZ");
+
+    rz.configure_module<first_sensor>();
+    wait(1, SC_US);
+    sc_assert(count_signal.read() == 7);
+    sc_assert(level_signal.read() == 7);
+    sc_assert(bus_signal.read() == driven);
+    sc_assert(status_signal.read() == 0);
+    sc_assert(ratio_signal.read() == 1.0);
+    sc_assert(level_changes == 1);
+
+    // every member exposes the value of its policy while decoupled
+    rz.unload_module();
+    wait(1, SC_US);
+    sc_assert(count_signal.read() == 0);
+    sc_assert(level_signal.read() == 7);
+    sc_assert(bus_signal.read() == high_z);
+    sc_assert(status_signal.read() == -1);
+    sc_assert(ratio_signal.read() == 0.5);
+    sc_assert(level_changes == 1);
+
+    // the held level only changes once the next module drives it
+    rz.configure_module<second_sensor>();
+    sc_assert(level_signal.read() == 7);
+    wait(1, SC_US);
+    sc_assert(level_signal.read() == 9);
+    sc_assert(bus_signal.read() == driven);
+    sc_assert(level_changes == 2);
+
+    NC_REPORT_TIMED_INFO(name(), "Decoupled outputs followed their policies.")
+  }
+};
+
+int sc_main(int argc, char** argv) {
+  top t("top");
+
+  sc_start(1, SC_MS);
+
+  return 0;
+}
@@ -0,0 +1,77 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+
+#ifndef DELTA_TEST_MODULES_H
+#define DELTA_TEST_MODULES_H
+
+#include <vector>
+
+#include "test_fixture.h"
+
+/// @brief Frames of the test regions, 4 KiB each, loaded in 4 us.
+constexpr size_t frame_count = 16;
+constexpr size_t frame_size = 4 * 1024;
+
+/**
+ * Filter variant that is derived from a shared base design. The first 12
+ * frames belong to the base and are the same for all variants, the last 4
+ * frames differ.
+ *
+ * @tparam Variant the id of the variant
+ */
+template <int Variant>
+NC_MODULE(filter_variant, filter_interface) {
+ public:
+  NC_CTOR(filter_variant, filter_interface) {}
+
+  size_t get_bitstream_size_bytes() const override {
+    return frame_count * frame_size;
+  }
+
+  std::vector<size_t> get_frame_signatures() const override {
+    std::vector<size_t> signatures;
+    for (size_t i = 0; i < frame_count; i++) {
+      signatures.push_back(i < 12 ? i : 1000 * Variant + i);
+    }
+    return signatures;
+  }
+};
+
+typedef filter_variant<1> fast_filter;
+typedef filter_variant<2> small_filter;
+
+/**
+ * Module that has nothing in common with the filters.
+ */
+NC_MODULE(unrelated_module, filter_interface) {
+ public:
+  NC_CTOR(unrelated_module, filter_interface) {}
+
+  size_t get_bitstream_size_bytes() const override {
+    return frame_count * frame_size;
+  }
+
+  std::vector<size_t> get_frame_signatures() const override {
+    std::vector<size_t> signatures;
+    for (size_t i = 0; i < frame_count; i++) signatures.push_back(500 + i);
+    return signatures;
+  }
+};
+
+/**
+ * Module without frame signatures, which is always load completely.
+ */
+NC_MODULE(opaque_module, filter_interface) {
+ public:
+  NC_CTOR(opaque_module, filter_interface) {}
+
+  size_t get_bitstream_size_bytes() const override {
+    return frame_count * frame_size;
+  }
+};
+
+#endif  // DELTA_TEST_MODULES_H
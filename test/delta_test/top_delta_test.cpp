@@ -0,0 +1,75 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+
+#include <systemc>
+
+#include "test_modules.h"
+
+using namespace sc_core;
+
+struct top : public sc_module {
+  reconf_region<filter_interface> rz{"rz"}, rz_plain{"rz_plain"};
+  sc_signal<int> output_signal, plain_output_signal;
+
+  SC_HAS_PROCESS(top);
+  explicit top(const sc_module_name& nm) : sc_module(nm) {
+    rz.register_module<fast_filter>();
+    rz.register_module<small_filter>();
+    rz.register_module<unrelated_module>();
+    rz.register_module<opaque_module>();
+    rz.set_frame_model(frame_count, frame_size);
+    rz.output.bind(output_signal);
+
+    rz_plain.register_module<fast_filter>();
+    rz_plain.register_module<small_filter>();
+    rz_plain.output.bind(plain_output_signal);
+
+    SC_THREAD(verify)
+  }
+
+  /**
+   * Configure a module and check the time it took.
+   */
+  template <class Module>
+  void check_load(reconf_region<filter_interface>& rr, int expected_us) {
+    sc_time start = sc_time_stamp();
+    rr.configure_module<Module>();
+    sc_assert(sc_time_stamp() - start == sc_time(expected_us, SC_US));
+  }
+
+  void verify() {
+    // the content of the frames is unknown at first
+    check_load<fast_filter>(rz, 64);
+
+    // only the 4 frames that are not part of the shared base are load
+    sc_assert(rz.get_delta_load_time<small_filter>() == sc_time(16, SC_US));
+    check_load<small_filter>(rz, 16);
+    check_load<fast_filter>(rz, 16);
+
+    check_load<unrelated_module>(rz, 64);
+
+    // without signatures, the content of the frames is unknown afterwards
+    check_load<opaque_module>(rz, 64);
+    check_load<fast_filter>(rz, 64);
+    sc_assert(rz.get_loaded_bytes() == 288 * 1024);
+
+    // without frame model, every module is load completely
+    check_load<fast_filter>(rz_plain, 64);
+    check_load<small_filter>(rz_plain, 64);
+    sc_assert(rz_plain.get_loaded_bytes() == 128 * 1024);
+
+    NC_REPORT_TIMED_INFO(name(), "Delta loading worked as expected.")
+  }
+};
+
+int sc_main(int argc, char** argv) {
+  top t("top");
+
+  sc_start(1, SC_MS);
+
+  return 0;
+}
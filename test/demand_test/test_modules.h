@@ -0,0 +1,67 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+
+#ifndef DEMAND_TEST_MODULES_H
+#define DEMAND_TEST_MODULES_H
+
+#include <tlm_utils/simple_target_socket.h>
+
+#include "memory_interface.h"
+#include "test_fixture.h"
+
+/**
+ * Counts the transactions it handled, each of them takes 10 ns. Loads in
+ * 64 us.
+ */
+NC_MODULE(counting_module, memory_interface) {
+  tlm_utils::simple_target_socket<counting_module> simple_tsock{
+      "counting_simple_tsock"};
+
+ public:
+  size_t handled = 0;
+
+  NC_CTOR(counting_module, memory_interface) {
+    tsock.bind(simple_tsock);
+    simple_tsock.register_b_transport(this, &counting_module::b_transport);
+  }
+
+  TEST_BITSTREAM_KIB(64)
+
+  void b_transport(tlm::tlm_generic_payload & trans, sc_core::sc_time & t) {
+    sc_core::wait(10, sc_core::SC_NS);
+    handled++;
+    trans.set_response_status(tlm::TLM_OK_RESPONSE);
+  }
+};
+
+/**
+ * Same as the counting_module, but a distinct type so that it can be
+ * registered at the same reconfiguration region.
+ */
+NC_MODULE(other_counting_module, memory_interface) {
+  tlm_utils::simple_target_socket<other_counting_module> simple_tsock{
+      "other_counting_simple_tsock"};
+
+ public:
+  size_t handled = 0;
+
+  NC_CTOR(other_counting_module, memory_interface) {
+    tsock.bind(simple_tsock);
+    simple_tsock.register_b_transport(this,
+                                      &other_counting_module::b_transport);
+  }
+
+  TEST_BITSTREAM_KIB(64)
+
+  void b_transport(tlm::tlm_generic_payload & trans, sc_core::sc_time & t) {
+    sc_core::wait(10, sc_core::SC_NS);
+    handled++;
+    trans.set_response_status(tlm::TLM_OK_RESPONSE);
+  }
+};
+
+#endif  // DEMAND_TEST_MODULES_H
@@ -0,0 +1,226 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+
+#include <tlm_utils/simple_initiator_socket.h>
+
+#include <systemc>
+
+#include "region/shadow_reconf_region.h"
+#include "test_modules.h"
+
+using namespace sc_core;
+
+/**
+ * Sends blocking transactions to the reconfiguration region, without knowing
+ * which module is configured.
+ */
+struct sender : public sc_module {
+  tlm_utils::simple_initiator_socket<sender> isock{"isock"};
+
+  explicit sender(const sc_module_name& nm) : sc_module(nm) {}
+
+  tlm::tlm_response_status try_send(sc_dt::uint64 address,
+                                    nc_module_tag* tag = nullptr) {
+    tlm::tlm_generic_payload trans;
+    sc_time delay = SC_ZERO_TIME;
+    trans.set_command(tlm::TLM_READ_COMMAND);
+    trans.set_address(address);
+    if (tag != nullptr) trans.set_extension(tag);
+
+    isock->b_transport(trans, delay);
+
+    if (tag != nullptr) trans.clear_extension(tag);
+    return trans.get_response_status();
+  }
+
+  void send(sc_dt::uint64 address, nc_module_tag* tag = nullptr) {
+    sc_assert(try_send(address, tag) == tlm::TLM_OK_RESPONSE);
+  }
+
+  tlm::tlm_response_status try_send_nb(sc_dt::uint64 address) {
+    tlm::tlm_generic_payload trans;
+    tlm::tlm_phase phase = tlm::BEGIN_REQ;
+    sc_time delay = SC_ZERO_TIME;
+    trans.set_command(tlm::TLM_READ_COMMAND);
+    trans.set_address(address);
+
+    sc_assert(isock->nb_transport_fw(trans, phase, delay) ==
+              tlm::TLM_COMPLETED);
+    return trans.get_response_status();
+  }
+
+  bool try_get_dmi(sc_dt::uint64 address) {
+    tlm::tlm_generic_payload trans;
+    tlm::tlm_dmi dmi_data;
+    trans.set_command(tlm::TLM_READ_COMMAND);
+    trans.set_address(address);
+    return isock->get_direct_mem_ptr(trans, dmi_data);
+  }
+};
+
+struct top : public sc_module {
+  reconf_region<memory_interface> rz{"rz"};
+  sender s1{"s1"}, s2{"s2"};
+  sc_event start_concurrent, concurrent_done;
+  int done_count = 0;
+  sc_event start_abort;
+
+  // region whose configured module keeps serving during shadow loads
+  shadow_reconf_region<memory_interface> shadow_rz{"shadow_rz"};
+  sender s3{"s3"};
+  sc_event start_shadow_load;
+
+  // region that only receives non-blocking and DMI requests
+  reconf_region<memory_interface> nb_rz{"nb_rz"};
+  sender s4{"s4"};
+
+  SC_HAS_PROCESS(top);
+  explicit top(const sc_module_name& nm) : sc_module(nm) {
+    rz.register_module<counting_module>();
+    rz.register_module<other_counting_module>();
+    rz.register_demand_range<counting_module>(0x0, 0xff);
+    rz.register_demand_range<other_counting_module>(0x100, 0x1ff);
+    rz.enable_demand_configuration();
+
+    s1.isock.bind(rz.tsock);
+    s2.isock.bind(rz.tsock);
+
+    shadow_rz.register_module<counting_module>();
+    shadow_rz.register_module<other_counting_module>();
+    shadow_rz.register_demand_range<counting_module>(0x0, 0xff);
+    shadow_rz.register_demand_range<other_counting_module>(0x100, 0x1ff);
+    shadow_rz.enable_demand_configuration();
+    s3.isock.bind(shadow_rz.tsock);
+
+    nb_rz.register_module<counting_module>();
+    nb_rz.register_demand_range<counting_module>(0x0, 0xff);
+    nb_rz.enable_demand_configuration();
+    s4.isock.bind(nb_rz.tsock);
+
+    SC_THREAD(verify)
+    SC_THREAD(send_counting)
+    SC_THREAD(send_other)
+    SC_THREAD(abort_load)
+    SC_THREAD(verify_shadow)
+    SC_THREAD(load_shadow)
+    SC_THREAD(verify_nb)
+  }
+
+  void verify() {
+    auto counting = rz.get_module<counting_module>();
+    auto other = rz.get_module<other_counting_module>();
+
+    // nothing is configured, the first transaction configures the module
+    sc_time start = sc_time_stamp();
+    s1.send(0x10);
+    sc_assert(rz.get_current_module() == counting);
+    sc_assert(sc_time_stamp() - start ==
+              sc_time(64, SC_US) + sc_time(10, SC_NS));
+    sc_assert(rz.get_demand_miss_count() == 1);
+
+    // hits do not reconfigure
+    s1.send(0x20);
+    sc_assert(rz.get_demand_miss_count() == 1);
+    sc_assert(counting->handled == 2);
+
+    // the tag takes precedence over the address
+    nc_module_tag tag = nc_module_tag::of<other_counting_module>();
+    s1.send(0x30, &tag);
+    sc_assert(rz.get_current_module() == other);
+    sc_assert(rz.get_demand_miss_count() == 2);
+    sc_assert(other->handled == 1);
+
+    // concurrent transactions to different modules are served one after the
+    // other, the second waits until the first one is done
+    start_concurrent.notify();
+    while (done_count < 2) wait(concurrent_done);
+    sc_assert(rz.get_demand_miss_count() == 4);
+    sc_assert(counting->handled == 3);
+    sc_assert(other->handled == 2);
+    sc_assert(rz.get_current_module() == other);
+
+    // a transaction whose demanded load is aborted gets an error response
+    start_abort.notify();
+    sc_assert(s1.try_send(0x50) == tlm::TLM_GENERIC_ERROR_RESPONSE);
+    sc_assert(rz.get_demand_miss_count() == 5);
+    sc_assert(rz.get_current_module() == nullptr);
+    sc_assert(counting->handled == 3);
+
+    NC_REPORT_TIMED_INFO(name(), "Transactions configured their modules.")
+  }
+
+  void abort_load() {
+    wait(start_abort);
+    wait(10, SC_US);
+    sc_assert(rz.abort_configuration());
+  }
+
+  void verify_shadow() {
+    auto counting = shadow_rz.get_module<counting_module>();
+
+    s3.send(0x10);
+    sc_assert(shadow_rz.get_current_module() == counting);
+
+    // the configured module serves right away while the shadow context loads
+    start_shadow_load.notify();
+    wait(1, SC_US);
+    sc_assert(shadow_rz.is_shadow_loading());
+    sc_time start = sc_time_stamp();
+    s3.send(0x20);
+    sc_assert(sc_time_stamp() - start == sc_time(10, SC_NS));
+    sc_assert(shadow_rz.get_demand_miss_count() == 1);
+    sc_assert(counting->handled == 2);
+
+    NC_REPORT_TIMED_INFO(name(), "Shadow load did not delay transactions.")
+  }
+
+  void load_shadow() {
+    wait(start_shadow_load);
+    sc_assert(shadow_rz.load_shadow_module<other_counting_module>());
+  }
+
+  void verify_nb() {
+    // without a module, the transaction fails, but its module is configured
+    sc_assert(s4.try_send_nb(0x10) == tlm::TLM_GENERIC_ERROR_RESPONSE);
+    sc_assert(!s4.try_get_dmi(0x10));
+
+    // a retry during the load configures nothing else
+    wait(1, SC_US);
+    sc_assert(s4.try_send_nb(0x20) == tlm::TLM_GENERIC_ERROR_RESPONSE);
+
+    wait(64, SC_US);
+    sc_assert(nb_rz.get_current_module() ==
+              nb_rz.get_module<counting_module>());
+    sc_assert(nb_rz.get_demand_miss_count() == 1);
+
+    NC_REPORT_TIMED_INFO(name(), "Non-blocking transaction configured module.")
+  }
+
+  void send_counting() {
+    wait(start_concurrent);
+    s1.send(0x40);
+    done_count++;
+    concurrent_done.notify();
+  }
+
+  void send_other() {
+    wait(start_concurrent);
+    // arrive while the other module is reconfigured
+    wait(1, SC_US);
+    s2.send(0x150);
+    done_count++;
+    concurrent_done.notify();
+  }
+};
+
+int sc_main(int argc, char** argv) {
+  top t("top");
+
+  sc_start(1, SC_MS);
+
+  return 0;
+}
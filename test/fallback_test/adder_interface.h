@@ -0,0 +1,25 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+
+#ifndef FALLBACK_TEST_ADDER_INTERFACE_H
+#define FALLBACK_TEST_ADDER_INTERFACE_H
+
+#include <systemc>
+#include <tlm>
+
+#include "nc_interface.h"
+#include "region/reconf_region.h"
+
+NC_INTERFACE(adder_interface) {
+  tlm::tlm_target_socket<> tsock;
+
+  NC_LOAD_SPEED_MBPS(1024);
+
+  NC_INTERFACE_REGISTER(adder_interface, tsock);
+};
+
+#endif  // FALLBACK_TEST_ADDER_INTERFACE_H
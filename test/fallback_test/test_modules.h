@@ -0,0 +1,52 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+
+#ifndef FALLBACK_TEST_MODULES_H
+#define FALLBACK_TEST_MODULES_H
+
+#include <tlm_utils/simple_target_socket.h>
+
+#include "adder_interface.h"
+#include "region/nc_software_model.h"
+#include "test_fixture.h"
+
+/**
+ * Increments the integer that is transferred, which takes 10 ns. Loads in
+ * 64 us.
+ */
+NC_MODULE(hw_adder, adder_interface) {
+  tlm_utils::simple_target_socket<hw_adder> simple_tsock{
+      "hw_adder_simple_tsock"};
+
+ public:
+  NC_CTOR(hw_adder, adder_interface) {
+    tsock.bind(simple_tsock);
+    simple_tsock.register_b_transport(this, &hw_adder::b_transport);
+  }
+
+  TEST_BITSTREAM_KIB(64)
+
+  void b_transport(tlm::tlm_generic_payload & trans, sc_core::sc_time & t) {
+    (*reinterpret_cast<int*>(trans.get_data_ptr()))++;
+    t += sc_core::sc_time(10, sc_core::SC_NS);
+    trans.set_response_status(tlm::TLM_OK_RESPONSE);
+  }
+};
+
+/**
+ * Software model of the hw_adder, which takes 1 us.
+ */
+struct sw_adder : public nc_software_model {
+  void b_transport(tlm::tlm_generic_payload& trans,
+                   sc_core::sc_time& t) override {
+    (*reinterpret_cast<int*>(trans.get_data_ptr()))++;
+    t += sc_core::sc_time(1, sc_core::SC_US);
+    trans.set_response_status(tlm::TLM_OK_RESPONSE);
+  }
+};
+
+#endif  // FALLBACK_TEST_MODULES_H
@@ -0,0 +1,123 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+
+#include <tlm_utils/simple_initiator_socket.h>
+
+#include <memory>
+#include <systemc>
+
+#include "test_modules.h"
+
+using namespace sc_core;
+
+struct top : public sc_module {
+  reconf_region<adder_interface> rz{"rz"};
+  tlm_utils::simple_initiator_socket<top> isock{"isock"};
+
+  SC_HAS_PROCESS(top);
+  explicit top(const sc_module_name& nm) : sc_module(nm) {
+    rz.register_module<hw_adder>();
+    rz.register_software_model<hw_adder>(std::make_shared<sw_adder>());
+
+    isock.bind(rz.tsock);
+
+    SC_THREAD(verify)
+    SC_THREAD(reconfigure)
+  }
+
+  /**
+   * Send a transaction that increments the given value and return the
+   * annotated delay.
+   */
+  sc_time send(int& value, nc_module_tag* tag = nullptr) {
+    tlm::tlm_generic_payload trans;
+    sc_time delay = SC_ZERO_TIME;
+    trans.set_command(tlm::TLM_WRITE_COMMAND);
+    trans.set_data_ptr(reinterpret_cast<unsigned char*>(&value));
+    trans.set_data_length(sizeof(value));
+    if (tag != nullptr) trans.set_extension(tag);
+
+    isock->b_transport(trans, delay);
+    sc_assert(trans.is_response_ok());
+
+    if (tag != nullptr) trans.clear_extension(tag);
+    return delay;
+  }
+
+  /**
+   * Send a non-blocking transaction that increments the given value and return
+   * the annotated delay.
+   */
+  sc_time send_nb(int& value) {
+    tlm::tlm_generic_payload trans;
+    tlm::tlm_phase phase = tlm::BEGIN_REQ;
+    sc_time delay = SC_ZERO_TIME;
+    trans.set_command(tlm::TLM_WRITE_COMMAND);
+    trans.set_data_ptr(reinterpret_cast<unsigned char*>(&value));
+    trans.set_data_length(sizeof(value));
+
+    sc_assert(isock->nb_transport_fw(trans, phase, delay) ==
+              tlm::TLM_COMPLETED);
+    sc_assert(trans.is_response_ok());
+    return delay;
+  }
+
+  /**
+   * Check whether a DMI pointer is granted.
+   */
+  bool get_dmi() {
+    tlm::tlm_generic_payload trans;
+    tlm::tlm_dmi dmi_data;
+    trans.set_command(tlm::TLM_WRITE_COMMAND);
+    return isock->get_direct_mem_ptr(trans, dmi_data);
+  }
+
+  void reconfigure() {
+    wait(10, SC_US);
+    rz.configure_module<hw_adder>();
+  }
+
+  void verify() {
+    int value = 0;
+
+    // the region is empty, the tagged transaction is served by software
+    nc_module_tag tag = nc_module_tag::of<hw_adder>();
+    sc_assert(send(value, &tag) == sc_time(1, SC_US));
+    sc_assert(value == 1);
+    sc_assert(rz.get_software_request_count() == 1);
+
+    // during reconfiguration, the module being configured is stood in for
+    wait(20, SC_US);
+    sc_assert(rz.is_reconfiguring());
+    sc_assert(send(value) == sc_time(1, SC_US));
+    sc_assert(value == 2);
+    sc_assert(rz.get_software_request_count() == 2);
+
+    // non-blocking transactions are completed by software, but without DMI
+    sc_assert(send_nb(value) == sc_time(1, SC_US));
+    sc_assert(value == 3);
+    sc_assert(rz.get_software_request_count() == 3);
+    sc_assert(!get_dmi());
+
+    // afterwards, the hardware serves the transactions
+    wait(100, SC_US);
+    sc_assert(!rz.is_reconfiguring());
+    sc_assert(send(value) == sc_time(10, SC_NS));
+    sc_assert(value == 4);
+    sc_assert(rz.get_software_request_count() == 3);
+
+    NC_REPORT_TIMED_INFO(name(), "Software model stood in for the module.")
+  }
+};
+
+int sc_main(int argc, char** argv) {
+  top t("top");
+
+  sc_start(1, SC_MS);
+
+  return 0;
+}
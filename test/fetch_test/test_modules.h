@@ -0,0 +1,56 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+
+#ifndef FETCH_TEST_MODULES_H
+#define FETCH_TEST_MODULES_H
+
+#include <tlm_utils/simple_target_socket.h>
+
+#include <algorithm>
+
+#include "test_fixture.h"
+
+/**
+ * Module whose bitstream is written in 64 us.
+ */
+NC_MODULE(large_module, filter_interface) {
+ public:
+  NC_CTOR(large_module, filter_interface) {}
+
+  TEST_BITSTREAM_KIB(64)
+};
+
+/**
+ * Memory that serves one transaction at a time at 4096 MB/s, so 4 KiB take
+ * 1 us. Transactions that arrive while the memory is busy wait.
+ */
+struct memory : public sc_core::sc_module {
+  tlm_utils::simple_target_socket<memory> tsock{"tsock"};
+  size_t reads = 0;
+  size_t read_bytes = 0;
+
+  explicit memory(const sc_core::sc_module_name& nm) : sc_module(nm) {
+    tsock.register_b_transport(this, &memory::b_transport);
+  }
+
+  void b_transport(tlm::tlm_generic_payload& trans, sc_core::sc_time& t) {
+    sc_core::sc_time start = std::max(sc_core::sc_time_stamp(), m_busy_until);
+    m_busy_until =
+        start + sc_core::sc_time(trans.get_data_length() / 4096.0,
+                                 sc_core::SC_US);
+    sc_core::wait(m_busy_until - sc_core::sc_time_stamp());
+
+    reads++;
+    read_bytes += trans.get_data_length();
+    trans.set_response_status(tlm::TLM_OK_RESPONSE);
+  }
+
+ private:
+  sc_core::sc_time m_busy_until = sc_core::SC_ZERO_TIME;
+};
+
+#endif  // FETCH_TEST_MODULES_H
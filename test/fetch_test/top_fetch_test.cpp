@@ -0,0 +1,86 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+
+#include <tlm_utils/simple_initiator_socket.h>
+
+#include <systemc>
+#include <vector>
+
+#include "test_modules.h"
+
+using namespace sc_core;
+
+struct top : public sc_module {
+  reconf_region<filter_interface> rz{"rz"}, rz_plain{"rz_plain"};
+  sc_signal<int> output_signal, plain_output_signal;
+  memory mem{"mem"};
+  tlm_utils::simple_initiator_socket<top> app_isock{"app_isock"};
+  sc_time app_latency;
+
+  SC_HAS_PROCESS(top);
+  explicit top(const sc_module_name& nm) : sc_module(nm) {
+    rz.register_module<large_module>();
+    rz.set_bitstream_address<large_module>(0x10000);
+    rz.enable_bitstream_fetch(4 * 1024).bind(mem.tsock);
+    rz.output.bind(output_signal);
+
+    rz_plain.register_module<large_module>();
+    rz_plain.output.bind(plain_output_signal);
+
+    app_isock.bind(mem.tsock);
+
+    SC_THREAD(verify)
+    SC_THREAD(application)
+  }
+
+  /**
+   * Read 4 KiB from the memory while the second burst of the bitstream is
+   * fetched.
+   */
+  void application() {
+    wait(1500, SC_NS);
+
+    std::vector<unsigned char> data(4 * 1024);
+    tlm::tlm_generic_payload trans;
+    sc_time delay = SC_ZERO_TIME;
+    trans.set_command(tlm::TLM_READ_COMMAND);
+    trans.set_data_ptr(data.data());
+    trans.set_data_length(data.size());
+
+    sc_time start = sc_time_stamp();
+    app_isock->b_transport(trans, delay);
+    app_latency = sc_time_stamp() - start;
+  }
+
+  void verify() {
+    // the port writes a burst in 4 us while the next one is fetched in 1 us,
+    // so only the fetch of the first burst adds to the load time
+    rz.configure_module<large_module>();
+    sc_assert(sc_time_stamp() == sc_time(65, SC_US));
+    sc_assert(mem.reads == 17);
+    sc_assert(mem.read_bytes == 68 * 1024);
+
+    // the application waited for the memory to finish the burst
+    sc_assert(app_latency == sc_time(1500, SC_NS));
+
+    // without fetching, there is no traffic
+    sc_time start = sc_time_stamp();
+    rz_plain.configure_module<large_module>();
+    sc_assert(sc_time_stamp() - start == sc_time(64, SC_US));
+    sc_assert(mem.reads == 17);
+
+    NC_REPORT_TIMED_INFO(name(), "Bitstream was fetched from memory.")
+  }
+};
+
+int sc_main(int argc, char** argv) {
+  top t("top");
+
+  sc_start(1, SC_MS);
+
+  return 0;
+}
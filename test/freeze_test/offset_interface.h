@@ -0,0 +1,27 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+
+#ifndef FREEZE_TEST_OFFSET_INTERFACE_H
+#define FREEZE_TEST_OFFSET_INTERFACE_H
+
+#include <systemc>
+#include <tlm>
+
+#include "nc_interface.h"
+#include "region/reconf_region.h"
+
+NC_INTERFACE(offset_interface) {
+  sc_core::sc_in<int> input;
+  sc_core::sc_out<int> output;
+  tlm::tlm_target_socket<> tsock;
+
+  NC_LOAD_SPEED_MBPS(1024);
+
+  NC_INTERFACE_REGISTER(offset_interface, input, output, tsock);
+};
+
+#endif  // FREEZE_TEST_OFFSET_INTERFACE_H
@@ -0,0 +1,95 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+
+#ifndef FREEZE_TEST_MODULES_H
+#define FREEZE_TEST_MODULES_H
+
+#include <tlm_utils/simple_initiator_socket.h>
+#include <tlm_utils/simple_target_socket.h>
+
+#include "offset_interface.h"
+
+/**
+ * Adds an offset to its input. The offset can be set by a TLM write.
+ */
+NC_MODULE(offset_module, offset_interface) {
+  tlm_utils::simple_target_socket<offset_module> simple_tsock{
+      "offset_simple_tsock"};
+
+ public:
+  int offset = 1;
+
+  SC_HAS_PROCESS(offset_module);
+  NC_CTOR(offset_module, offset_interface) {
+    tsock.bind(simple_tsock);
+    simple_tsock.register_b_transport(this, &offset_module::b_transport);
+
+    NC_METHOD(add);
+    sensitive << input;
+  }
+
+  void add() { output.write(input.read() + offset); }
+
+  void b_transport(tlm::tlm_generic_payload & trans, sc_core::sc_time & t) {
+    offset = *reinterpret_cast<int*>(trans.get_data_ptr());
+    trans.set_response_status(tlm::TLM_OK_RESPONSE);
+  }
+};
+
+/**
+ * Never configured, only registered to check that the adapters of the other
+ * modules are still bound when one module is frozen.
+ */
+NC_MODULE(idle_module, offset_interface) {
+  tlm_utils::simple_target_socket<idle_module> simple_tsock{
+      "idle_simple_tsock"};
+
+ public:
+  NC_CTOR(idle_module, offset_interface) { tsock.bind(simple_tsock); }
+};
+
+/**
+ * Contains a nested region with a frozen offset_module and adds 100 to the
+ * nested output. Transactions are forwarded to the nested region.
+ */
+NC_MODULE(wrapper_module, offset_interface) {
+  tlm_utils::simple_target_socket<wrapper_module> simple_tsock{
+      "wrapper_simple_tsock"};
+  tlm_utils::simple_initiator_socket<wrapper_module> inner_isock{
+      "inner_isock"};
+  sc_core::sc_signal<int> inner_signal;
+  sc_core::sc_in<int> inner_output;
+
+ public:
+  reconf_region<offset_interface> inner_rz;
+
+  SC_HAS_PROCESS(wrapper_module);
+  NC_CTOR(wrapper_module, offset_interface)
+  , inner_rz("inner_rz", this) {
+    inner_rz.register_module<offset_module>();
+    inner_rz.freeze<offset_module>();
+
+    inner_rz.input.bind(input);
+    inner_rz.output.bind(inner_signal);
+    inner_output.bind(inner_signal);
+    inner_isock.bind(inner_rz.tsock);
+
+    tsock.bind(simple_tsock);
+    simple_tsock.register_b_transport(this, &wrapper_module::b_transport);
+
+    NC_METHOD(add);
+    sensitive << inner_output;
+  }
+
+  void add() { output.write(inner_output.read() + 100); }
+
+  void b_transport(tlm::tlm_generic_payload & trans, sc_core::sc_time & t) {
+    inner_isock->b_transport(trans, t);
+  }
+};
+
+#endif  // FREEZE_TEST_MODULES_H
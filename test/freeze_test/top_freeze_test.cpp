@@ -0,0 +1,117 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+
+#include <tlm_utils/simple_initiator_socket.h>
+
+#include <systemc>
+
+#include "test_modules.h"
+
+using namespace sc_core;
+
+struct top : public sc_module {
+  reconf_region<offset_interface> rz{"rz"};
+  sc_signal<int> in_signal, out_signal;
+  tlm_utils::simple_initiator_socket<top> isock{"isock"};
+
+  // region whose wrapper_module contains a nested region with a frozen module
+  reconf_region<offset_interface> outer_rz{"outer_rz"};
+  sc_signal<int> outer_in_signal, outer_out_signal;
+  tlm_utils::simple_initiator_socket<top> outer_isock{"outer_isock"};
+
+  SC_HAS_PROCESS(top);
+  explicit top(const sc_module_name& nm) : sc_module(nm) {
+    rz.register_module<offset_module>();
+    rz.register_module<idle_module>();
+    rz.freeze<offset_module>();
+
+    rz.input.bind(in_signal);
+    rz.output.bind(out_signal);
+    isock.bind(rz.tsock);
+
+    outer_rz.register_module<wrapper_module>();
+    outer_rz.register_module<offset_module>();
+
+    outer_rz.input.bind(outer_in_signal);
+    outer_rz.output.bind(outer_out_signal);
+    outer_isock.bind(outer_rz.tsock);
+
+    SC_THREAD(verify)
+  }
+
+  void verify() {
+    auto module = rz.get_module<offset_module>();
+
+    // the frozen module is configured right from the start
+    sc_assert(rz.is_frozen());
+    sc_assert(rz.get_current_module() == module);
+
+    in_signal.write(1);
+    wait(1, SC_NS);
+    sc_assert(out_signal.read() == 2);
+
+    // transactions reach the module directly
+    int offset = 10;
+    tlm::tlm_generic_payload trans;
+    sc_time delay = SC_ZERO_TIME;
+    trans.set_command(tlm::TLM_WRITE_COMMAND);
+    trans.set_data_ptr(reinterpret_cast<unsigned char*>(&offset));
+    trans.set_data_length(sizeof(offset));
+    isock->b_transport(trans, delay);
+    sc_assert(trans.is_response_ok());
+    sc_assert(module->offset == 10);
+
+    in_signal.write(5);
+    wait(1, SC_NS);
+    sc_assert(out_signal.read() == 15);
+
+    NC_REPORT_TIMED_INFO(name(), "Frozen module ran without adapters.")
+
+    verify_nested();
+  }
+
+  void verify_nested() {
+    auto wrapper = outer_rz.get_module<wrapper_module>();
+    auto& inner_rz = wrapper->inner_rz;
+    auto inner = inner_rz.get_module<offset_module>();
+
+    // the frozen module is loaded once the wrapper is activated
+    outer_rz.configure_module<wrapper_module>();
+    sc_assert(inner_rz.is_frozen());
+    sc_assert(inner_rz.get_current_module() == inner);
+
+    outer_in_signal.write(1);
+    wait(1, SC_NS);
+    sc_assert(outer_out_signal.read() == 102);
+
+    // deactivating the wrapper unloads the frozen module without an error
+    outer_rz.configure_module<offset_module>();
+    sc_assert(inner_rz.get_current_module() == nullptr);
+    outer_in_signal.write(2);
+    wait(1, SC_NS);
+    sc_assert(outer_out_signal.read() == 3);
+
+    // and activating it again loads the frozen module again
+    outer_rz.configure_module<wrapper_module>();
+    sc_assert(inner_rz.get_current_module() == inner);
+
+    outer_in_signal.write(3);
+    wait(1, SC_NS);
+    sc_assert(outer_out_signal.read() == 104);
+
+    NC_REPORT_TIMED_INFO(name(),
+                         "Frozen module was reloaded with its nested region.")
+  }
+};
+
+int sc_main(int argc, char** argv) {
+  top t("top");
+
+  sc_start(100, SC_US);
+
+  return 0;
+}
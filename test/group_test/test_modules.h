@@ -0,0 +1,61 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+
+#ifndef GROUP_TEST_MODULES_H
+#define GROUP_TEST_MODULES_H
+
+#include "test_fixture.h"
+
+/**
+ * Pipeline stage that records when it was activated.
+ *
+ * @tparam BitstreamKiB the size of the bitstream in KiB
+ * @tparam Mode the processing mode that the stage belongs to
+ * @tparam AckDelayUs the time in us that the stage needs to acknowledge an
+ * imminent reconfiguration, 0 to acknowledge right away
+ */
+template <size_t BitstreamKiB, int Mode, int AckDelayUs = 0>
+NC_MODULE(stage_module, filter_interface) {
+ public:
+  size_t activations = 0;
+  sc_core::sc_time activated_at;
+
+  SC_HAS_PROCESS(stage_module);
+  NC_CTOR(stage_module, filter_interface) { NC_THREAD(drain); }
+
+  void drain() {
+    wait(reconf_imminent);
+    wait(AckDelayUs, sc_core::SC_US);
+    acknowledge_reconf();
+  }
+
+  TEST_BITSTREAM_KIB(BitstreamKiB)
+
+ protected:
+  void on_activate() override {
+    activations++;
+    activated_at = sc_core::sc_time_stamp();
+  }
+
+  bool on_reconf_imminent() override {
+    reconf_imminent.notify();
+    return AckDelayUs == 0;
+  }
+
+ private:
+  sc_core::sc_event reconf_imminent;
+};
+
+typedef stage_module<16, 1> first_stage_a;
+typedef stage_module<16, 2> first_stage_b;
+typedef stage_module<32, 1> second_stage_a;
+typedef stage_module<32, 2> second_stage_b;
+typedef stage_module<48, 1> third_stage;
+typedef stage_module<16, 3, 10> slow_first_stage;
+typedef stage_module<16, 3, 20> slow_second_stage;
+
+#endif  // GROUP_TEST_MODULES_H
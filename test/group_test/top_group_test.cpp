@@ -0,0 +1,133 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+
+#include <systemc>
+
+#include "region/reconf_region_group.h"
+#include "test_modules.h"
+
+using namespace sc_core;
+
+struct top : public sc_module {
+  reconf_region<filter_interface> rz1{"rz1"};
+  reconf_region<filter_interface> rz2{"rz2"};
+  reconf_region<filter_interface> rz3{"rz3"};
+  sc_signal<int> output_signals[3];
+  reconf_region_group group{"group"};
+
+  SC_HAS_PROCESS(top);
+  explicit top(const sc_module_name& nm) : sc_module(nm) {
+    rz1.register_module<first_stage_a>();
+    rz1.register_module<first_stage_b>();
+    rz1.register_module<slow_first_stage>();
+    rz2.register_module<second_stage_a>();
+    rz2.register_module<second_stage_b>();
+    rz2.register_module<slow_second_stage>();
+    rz3.register_module<third_stage>();
+    rz1.output.bind(output_signals[0]);
+    rz2.output.bind(output_signals[1]);
+    rz3.output.bind(output_signals[2]);
+
+    SC_THREAD(verify)
+    SC_THREAD(abort_second_stage)
+    SC_THREAD(claim_second_stage)
+  }
+
+  /**
+   * Reconfigure the second region on its own, while a group configuration
+   * waits to claim it.
+   */
+  void claim_second_stage() {
+    wait(190, SC_US);
+    sc_assert(rz2.configure_module<second_stage_b>());
+  }
+
+  /**
+   * Abort the load at the second region during the last group configuration.
+   */
+  void abort_second_stage() {
+    wait(104, SC_US);
+    sc_assert(rz2.abort_configuration());
+  }
+
+  void verify() {
+    typedef reconf_region_group g;
+
+    // all three bitstreams are loaded at the same time
+    sc_assert(group.configure({g::configure_at<first_stage_a>(rz1),
+                               g::configure_at<second_stage_a>(rz2),
+                               g::configure_at<third_stage>(rz3)}));
+    sc_assert(sc_time_stamp() == sc_time(48, SC_US));
+    sc_assert(group.get_downtime() == sc_time(48, SC_US));
+    sc_assert(rz1.get_module<first_stage_a>()->activated_at ==
+              sc_time(48, SC_US));
+    sc_assert(rz2.get_module<second_stage_a>()->activated_at ==
+              sc_time(48, SC_US));
+    sc_assert(rz3.get_module<third_stage>()->activated_at ==
+              sc_time(48, SC_US));
+
+    // one at a time, but still coupled together, the third stage keeps running
+    group.set_parallel_loads(1);
+    sc_assert(group.configure({g::configure_at<first_stage_b>(rz1),
+                               g::configure_at<second_stage_b>(rz2),
+                               g::configure_at<third_stage>(rz3)}));
+    sc_assert(sc_time_stamp() == sc_time(96, SC_US));
+    sc_assert(group.get_downtime() == sc_time(48, SC_US));
+    sc_assert(rz1.get_current_module() == rz1.get_module<first_stage_b>());
+    sc_assert(rz2.get_current_module() == rz2.get_module<second_stage_b>());
+    sc_assert(rz1.get_module<first_stage_b>()->activated_at ==
+              sc_time(96, SC_US));
+    sc_assert(rz2.get_module<second_stage_b>()->activated_at ==
+              sc_time(96, SC_US));
+    sc_assert(rz3.get_module<third_stage>()->activations == 1);
+
+    // the abort at the second region aborts the load at the first one too
+    group.set_parallel_loads(0);
+    sc_assert(!group.configure({g::configure_at<first_stage_a>(rz1),
+                                g::configure_at<second_stage_a>(rz2)}));
+    sc_assert(sc_time_stamp() == sc_time(104, SC_US));
+    sc_assert(rz1.get_current_module() == nullptr);
+    sc_assert(rz2.get_current_module() == nullptr);
+    sc_assert(!rz1.is_reconfiguring() && !rz2.is_reconfiguring());
+    sc_assert(rz1.get_module<first_stage_a>()->activations == 1);
+
+    sc_assert(group.get_configuration_count() == 3);
+    sc_assert(group.get_total_downtime() == sc_time(104, SC_US));
+
+    // the slow stages are awaited together before any region is blocked
+    sc_assert(group.configure({g::configure_at<slow_first_stage>(rz1),
+                               g::configure_at<slow_second_stage>(rz2)}));
+    sc_assert(sc_time_stamp() == sc_time(120, SC_US));
+    sc_assert(group.configure({g::configure_at<first_stage_a>(rz1),
+                               g::configure_at<second_stage_a>(rz2)}));
+    sc_assert(sc_time_stamp() == sc_time(172, SC_US));
+    sc_assert(group.get_downtime() == sc_time(32, SC_US));
+    sc_assert(rz1.get_quiescence_time() == sc_time(10, SC_US));
+    sc_assert(rz2.get_quiescence_time() == sc_time(20, SC_US));
+
+    // a region that is reconfigured on its own is waited for, not an error
+    wait(20, SC_US);
+    sc_assert(rz2.is_reconfiguring());
+    sc_assert(group.configure({g::configure_at<first_stage_b>(rz1),
+                               g::configure_at<second_stage_a>(rz2)}));
+    sc_assert(sc_time_stamp() == sc_time(254, SC_US));
+    sc_assert(rz1.get_module<first_stage_b>()->activated_at ==
+              sc_time(254, SC_US));
+    sc_assert(rz2.get_module<second_stage_a>()->activated_at ==
+              sc_time(254, SC_US));
+
+    NC_REPORT_TIMED_INFO(name(), "Regions were reconfigured as a group.")
+  }
+};
+
+int sc_main(int argc, char** argv) {
+  top t("top");
+
+  sc_start(1, SC_MS);
+
+  return 0;
+}
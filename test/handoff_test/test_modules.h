@@ -0,0 +1,56 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+
+#ifndef HANDOFF_TEST_MODULES_H
+#define HANDOFF_TEST_MODULES_H
+
+#include <vector>
+
+#include "test_fixture.h"
+
+/// @brief Coefficients of a filter, 1 KiB in size.
+typedef std::vector<int> coefficient_set;
+
+/**
+ * Filter variant that continues with the coefficients of the variant it
+ * replaces, and hands its own coefficients off when it is replaced. Without
+ * handed off coefficients it starts with default ones.
+ *
+ * @tparam BitstreamKiB the size of the bitstream in KiB
+ */
+template <size_t BitstreamKiB>
+NC_MODULE(filter_variant, filter_interface) {
+ public:
+  coefficient_set coefficients;
+  size_t cold_starts = 0;
+  size_t warm_starts = 0;
+
+  NC_CTOR(filter_variant, filter_interface) {}
+
+  TEST_BITSTREAM_KIB(BitstreamKiB)
+
+ protected:
+  void on_activate() override {
+    auto state = take_handed_off_state<coefficient_set>();
+    if (state) {
+      coefficients = std::move(*state);
+      warm_starts++;
+    } else {
+      coefficients.assign(256, 1);
+      cold_starts++;
+    }
+  }
+
+  void on_deactivate() override {
+    hand_off_state(coefficients, coefficients.size() * sizeof(int));
+  }
+};
+
+typedef filter_variant<16> small_filter;
+typedef filter_variant<32> large_filter;
+
+#endif  // HANDOFF_TEST_MODULES_H
@@ -0,0 +1,101 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+
+#include <systemc>
+
+#include "region/shadow_reconf_region.h"
+#include "test_modules.h"
+
+using namespace sc_core;
+
+struct top : public sc_module {
+  reconf_region<filter_interface> rz{"rz"};
+  shadow_reconf_region<filter_interface> shadow_rz{"shadow_rz"};
+  sc_signal<int> output_signal;
+  sc_signal<int> shadow_output_signal;
+  sc_event start_abort;
+
+  SC_HAS_PROCESS(top);
+  explicit top(const sc_module_name& nm) : sc_module(nm) {
+    rz.register_module<small_filter>();
+    rz.register_module<large_filter>();
+    rz.output.bind(output_signal);
+    shadow_rz.register_module<small_filter>();
+    shadow_rz.register_module<large_filter>();
+    shadow_rz.output.bind(shadow_output_signal);
+
+    SC_THREAD(verify)
+    SC_THREAD(abort_load)
+  }
+
+  void abort_load() {
+    wait(start_abort);
+    wait(10, SC_US);
+    sc_assert(rz.abort_configuration());
+  }
+
+  void verify() {
+    auto small = rz.get_module<small_filter>();
+    auto large = rz.get_module<large_filter>();
+
+    rz.configure_module<small_filter>();
+    sc_assert(sc_time_stamp() == sc_time(16, SC_US));
+    sc_assert(small->cold_starts == 1);
+    small->coefficients[0] = 42;
+
+    // the coefficients follow to the large variant, transferred in 1 us
+    rz.configure_module<large_filter>();
+    sc_assert(sc_time_stamp() == sc_time(49, SC_US));
+    sc_assert(large->warm_starts == 1 && large->cold_starts == 0);
+    sc_assert(large->coefficients.size() == 256);
+    sc_assert(large->coefficients[0] == 42);
+    sc_assert(rz.get_handoff_time() == sc_time(1, SC_US));
+    sc_assert(rz.get_handoff_bytes() == 1024);
+
+    // a state is only handed off to the module that directly replaces one
+    rz.unload_module();
+    rz.configure_module<small_filter>();
+    sc_assert(sc_time_stamp() == sc_time(65, SC_US));
+    sc_assert(small->cold_starts == 2 && small->warm_starts == 0);
+    sc_assert(small->coefficients[0] == 1);
+    sc_assert(rz.get_handoff_bytes() == 1024);
+
+    // an aborted load loses the handed off state, which is reported
+    small->coefficients[0] = 5;
+    start_abort.notify();
+    sc_assert(!rz.configure_module<large_filter>());
+    sc_assert(rz.get_current_module() == nullptr);
+    sc_assert(rz.get_lost_handoff_count() == 1);
+    sc_assert(rz.get_handoff_bytes() == 1024);
+    rz.configure_module<small_filter>();
+    sc_assert(small->cold_starts == 3 && small->warm_starts == 0);
+    sc_assert(small->coefficients[0] == 1);
+
+    // swapping in a module from the shadow context hands the state off too
+    auto shadow_small = shadow_rz.get_module<small_filter>();
+    auto shadow_large = shadow_rz.get_module<large_filter>();
+    shadow_rz.configure_module<small_filter>();
+    shadow_small->coefficients[0] = 7;
+    sc_assert(shadow_rz.load_shadow_module<large_filter>());
+    sc_time swap_start = sc_time_stamp();
+    shadow_rz.swap_modules();
+    sc_assert(sc_time_stamp() == swap_start + sc_time(1, SC_US));
+    sc_assert(shadow_large->warm_starts == 1);
+    sc_assert(shadow_large->coefficients[0] == 7);
+    sc_assert(shadow_rz.get_handoff_bytes() == 1024);
+
+    NC_REPORT_TIMED_INFO(name(), "State was handed off between variants.")
+  }
+};
+
+int sc_main(int argc, char** argv) {
+  top t("top");
+
+  sc_start(1, SC_MS);
+
+  return 0;
+}
@@ -0,0 +1,29 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+
+#ifndef LIFECYCLE_TEST_MODULES_H
+#define LIFECYCLE_TEST_MODULES_H
+
+#include "test_fixture.h"
+
+/**
+ * Module without functionality.
+ *
+ * @tparam BitstreamKiB the size of the bitstream in KiB
+ */
+template <size_t BitstreamKiB>
+NC_MODULE(sized_module, filter_interface) {
+ public:
+  NC_CTOR(sized_module, filter_interface) {}
+
+  TEST_BITSTREAM_KIB(BitstreamKiB)
+};
+
+typedef sized_module<16> small_module;
+typedef sized_module<32> large_module;
+
+#endif  // LIFECYCLE_TEST_MODULES_H
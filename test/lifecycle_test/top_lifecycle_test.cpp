@@ -0,0 +1,110 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+
+#include <systemc>
+#include <vector>
+
+#include "test_modules.h"
+
+using namespace sc_core;
+
+typedef abstract_reconf_region_base::reconf_phase reconf_phase;
+
+/**
+ * A phase of a reconfiguration as seen by a listener.
+ */
+struct phase_record {
+  reconf_phase phase;
+  abstract_module_base* old_module;
+  abstract_module_base* new_module;
+  sc_time time;
+};
+
+struct top : public sc_module {
+  reconf_region<filter_interface> rz{"rz"};
+  sc_signal<int> output_signal;
+  std::vector<phase_record> records;
+  std::vector<sc_time> activations;
+
+  SC_HAS_PROCESS(top);
+  explicit top(const sc_module_name& nm) : sc_module(nm) {
+    rz.register_module<small_module>();
+    rz.register_module<large_module>();
+    rz.output.bind(output_signal);
+
+    rz.add_reconf_listener([this](reconf_phase phase, abstract_module_base* o,
+                                  abstract_module_base* n) {
+      records.push_back({phase, o, n, sc_time_stamp()});
+    });
+
+    SC_THREAD(verify)
+    SC_THREAD(observe)
+  }
+
+  /**
+   * Record when modules become active, only by waiting for the event.
+   */
+  void observe() {
+    while (true) {
+      wait(rz.module_active_event());
+      activations.push_back(sc_time_stamp());
+    }
+  }
+
+  /**
+   * Check the next recorded phase.
+   */
+  void check(size_t& i, reconf_phase phase, abstract_module_base* o,
+             abstract_module_base* n, int time_us) {
+    sc_assert(i < records.size());
+    sc_assert(records[i].phase == phase);
+    sc_assert(records[i].old_module == o && records[i].new_module == n);
+    sc_assert(records[i].time == sc_time(time_us, SC_US));
+    i++;
+  }
+
+  void verify() {
+    abstract_module_base* small = rz.get_module<small_module>().get();
+    abstract_module_base* large = rz.get_module<large_module>().get();
+
+    rz.configure_module<small_module>();
+    rz.configure_module<large_module>();
+    rz.unload_module();
+    wait(1, SC_US);
+
+    size_t i = 0;
+    check(i, reconf_phase::begin, nullptr, small, 0);
+    check(i, reconf_phase::load_done, nullptr, small, 16);
+    check(i, reconf_phase::module_active, nullptr, small, 16);
+    check(i, reconf_phase::end, nullptr, small, 16);
+
+    check(i, reconf_phase::begin, small, large, 16);
+    check(i, reconf_phase::unloaded, small, large, 16);
+    check(i, reconf_phase::load_done, small, large, 48);
+    check(i, reconf_phase::module_active, small, large, 48);
+    check(i, reconf_phase::end, small, large, 48);
+
+    check(i, reconf_phase::begin, large, nullptr, 48);
+    check(i, reconf_phase::unloaded, large, nullptr, 48);
+    check(i, reconf_phase::end, large, nullptr, 48);
+    sc_assert(i == records.size());
+
+    sc_assert(activations.size() == 2);
+    sc_assert(activations[0] == sc_time(16, SC_US));
+    sc_assert(activations[1] == sc_time(48, SC_US));
+
+    NC_REPORT_TIMED_INFO(name(), "Listeners saw all reconfiguration phases.")
+  }
+};
+
+int sc_main(int argc, char** argv) {
+  top t("top");
+
+  sc_start(1, SC_MS);
+
+  return 0;
+}
@@ -0,0 +1,71 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+
+#ifndef MANY_MEMBERS_TEST_MODULES_H
+#define MANY_MEMBERS_TEST_MODULES_H
+
+#include <algorithm>
+#include <array>
+
+#include "wide_interface.h"
+
+/**
+ * Drives the sum of all inputs on the sum output and the maximum of all inputs
+ * on the max output.
+ */
+NC_MODULE(reduce_module, wide_interface) {
+ public:
+  SC_HAS_PROCESS(reduce_module);
+  NC_CTOR(reduce_module, wide_interface) {
+    NC_METHOD(reduce);
+    for (auto in : inputs()) sensitive << *in;
+  }
+
+  /// @brief number of inputs of the interface
+  static constexpr size_t input_count = 32;
+
+  std::array<sc_core::sc_in<int>*, input_count> inputs() {
+    return {
+        &in0, &in1, &in2, &in3, &in4, &in5, &in6, &in7, &in8, &in9,
+        &in10, &in11, &in12, &in13, &in14, &in15, &in16, &in17, &in18,
+        &in19, &in20, &in21, &in22, &in23, &in24, &in25, &in26, &in27,
+        &in28, &in29, &in30, &in31};
+  }
+
+  void on_activate() override { NC_REPORT_TIMED_INFO(name(), "was load.") }
+
+  void reduce() {
+    int s = 0, m = in0.read();
+    for (auto in : inputs()) {
+      s += in->read();
+      m = std::max(m, in->read());
+    }
+    sum.write(s);
+    max.write(m);
+  }
+};
+
+/**
+ * Forwards the first and the last input to the outputs.
+ */
+NC_MODULE(forward_module, wide_interface) {
+ public:
+  SC_HAS_PROCESS(forward_module);
+  NC_CTOR(forward_module, wide_interface) {
+    NC_METHOD(forward);
+    sensitive << in0 << in31;
+  }
+
+  void on_activate() override { NC_REPORT_TIMED_INFO(name(), "was load.") }
+
+  void forward() {
+    sum.write(in0.read());
+    max.write(in31.read());
+  }
+};
+
+#endif  // MANY_MEMBERS_TEST_MODULES_H
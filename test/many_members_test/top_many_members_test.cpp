@@ -0,0 +1,76 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+
+#include <systemc>
+
+#include "test_modules.h"
+
+using namespace sc_core;
+
+struct top : public sc_module {
+  reconf_region<wide_interface> rz{"rz"};
+  sc_vector<sc_signal<int>> in_signals{"in_signal", reduce_module::input_count};
+  sc_signal<int> sum_signal, max_signal;
+
+  SC_HAS_PROCESS(top);
+  explicit top(const sc_module_name& nm) : sc_module(nm) {
+    rz.register_module<reduce_module>();
+    rz.register_module<forward_module>();
+
+    std::array<sc_in<int>*, reduce_module::input_count> inputs = {
+        &rz.in0, &rz.in1, &rz.in2, &rz.in3, &rz.in4, &rz.in5, &rz.in6,
+        &rz.in7, &rz.in8, &rz.in9, &rz.in10, &rz.in11, &rz.in12,
+        &rz.in13, &rz.in14, &rz.in15, &rz.in16, &rz.in17, &rz.in18,
+        &rz.in19, &rz.in20, &rz.in21, &rz.in22, &rz.in23, &rz.in24,
+        &rz.in25, &rz.in26, &rz.in27, &rz.in28, &rz.in29, &rz.in30,
+        &rz.in31};
+    for (size_t i = 0; i < inputs.size(); i++) inputs[i]->bind(in_signals[i]);
+    rz.sum.bind(sum_signal);
+    rz.max.bind(max_signal);
+
+    SC_THREAD(verify)
+  }
+
+  void drive(int offset) {
+    for (size_t i = 0; i < in_signals.size(); i++)
+      in_signals[i].write(static_cast<int>(i) + offset);
+  }
+
+  void verify() {
+    drive(0);
+    rz.configure_module<reduce_module>();
+    wait(1, SC_NS);
+    sc_assert(sum_signal.read() == 496);
+    sc_assert(max_signal.read() == 31);
+
+    drive(3);
+    wait(1, SC_NS);
+    sc_assert(sum_signal.read() == 592);
+    sc_assert(max_signal.read() == 34);
+
+    rz.configure_module<forward_module>();
+    drive(5);
+    wait(1, SC_NS);
+    sc_assert(sum_signal.read() == 5);
+    sc_assert(max_signal.read() == 36);
+
+    rz.unload_module();
+    wait(1, SC_NS);
+    sc_assert(sum_signal.read() == 0);
+    sc_assert(max_signal.read() == 36);
+
+    NC_REPORT_TIMED_INFO(name(), "All members were forwarded.")
+  }
+};
+
+int sc_main(int argc, char** argv) {
+  top t("top");
+
+  sc_start(100, SC_US);
+
+  return 0;
+}
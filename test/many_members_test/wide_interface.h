@@ -0,0 +1,50 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+
+#ifndef WIDE_INTERFACE_H
+#define WIDE_INTERFACE_H
+
+#include <systemc>
+
+#include "nc_interface.h"
+#include "region/reconf_region.h"
+
+/**
+ * Interface with 34 members, like a wide bus interface, which is more than
+ * NC_INTERFACE_REGISTER supports. It is registered via NC_INTERFACE_MEMBERS.
+ * The maximum keeps its last value while no module is coupled.
+ */
+NC_INTERFACE(wide_interface) {
+  sc_core::sc_in<int> in0, in1, in2, in3, in4, in5, in6, in7, in8, in9, in10,
+      in11, in12, in13, in14, in15, in16, in17, in18, in19, in20, in21, in22,
+      in23, in24, in25, in26, in27, in28, in29, in30, in31;
+  sc_core::sc_out<int> sum;
+  nc_out<int, nc_decouple_hold_last> max;
+
+  NC_LOAD_SPEED_MBPS(1024);
+
+  NC_INTERFACE_MEMBERS(wide_interface, &wide_interface::in0,
+                       &wide_interface::in1, &wide_interface::in2,
+                       &wide_interface::in3, &wide_interface::in4,
+                       &wide_interface::in5, &wide_interface::in6,
+                       &wide_interface::in7, &wide_interface::in8,
+                       &wide_interface::in9, &wide_interface::in10,
+                       &wide_interface::in11, &wide_interface::in12,
+                       &wide_interface::in13, &wide_interface::in14,
+                       &wide_interface::in15, &wide_interface::in16,
+                       &wide_interface::in17, &wide_interface::in18,
+                       &wide_interface::in19, &wide_interface::in20,
+                       &wide_interface::in21, &wide_interface::in22,
+                       &wide_interface::in23, &wide_interface::in24,
+                       &wide_interface::in25, &wide_interface::in26,
+                       &wide_interface::in27, &wide_interface::in28,
+                       &wide_interface::in29, &wide_interface::in30,
+                       &wide_interface::in31, &wide_interface::sum,
+                       &wide_interface::max);
+};
+
+#endif  // WIDE_INTERFACE_H
@@ -0,0 +1,25 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+
+#ifndef POOL_TEST_FILTER_INTERFACE_H
+#define POOL_TEST_FILTER_INTERFACE_H
+
+#include <systemc>
+
+#include "nc_interface.h"
+#include "region/reconf_region_pool.h"
+
+NC_INTERFACE(filter_interface) {
+  sc_core::sc_in<int> input;
+  sc_core::sc_out<int> output;
+
+  NC_LOAD_SPEED_MBPS(1024);
+
+  NC_INTERFACE_REGISTER(filter_interface, input, output);
+};
+
+#endif  // POOL_TEST_FILTER_INTERFACE_H
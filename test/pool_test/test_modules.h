@@ -0,0 +1,49 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+
+#ifndef POOL_TEST_MODULES_H
+#define POOL_TEST_MODULES_H
+
+#include "filter_interface.h"
+
+/**
+ * Filter that adds a constant to its input. The filters only differ in their
+ * type, so that several of them can be registered at a region.
+ *
+ * @tparam Offset the constant that is added
+ * @tparam BitstreamSize the size of the filter's bitstream in byte
+ * @tparam Acknowledges whether the filter acknowledges an imminent
+ * reconfiguration, otherwise it is only replaced after the quiescence timeout
+ */
+template <int Offset, size_t BitstreamSize = 64 * 1024,
+          bool Acknowledges = true>
+NC_MODULE(offset_filter, filter_interface) {
+ public:
+  SC_HAS_PROCESS(offset_filter);
+  NC_CTOR(offset_filter, filter_interface) {
+    NC_METHOD(filter);
+    sensitive << input;
+  }
+
+  size_t get_bitstream_size_bytes() const override { return BitstreamSize; }
+
+  void filter() { output.write(input.read() + Offset); }
+
+ protected:
+  bool on_reconf_imminent() override { return Acknowledges; }
+};
+
+// filters a, b and c load in 64 us, the big filter in 1024 us
+typedef offset_filter<1> filter_a;
+typedef offset_filter<2> filter_b;
+typedef offset_filter<3> filter_c;
+typedef offset_filter<4, 1024 * 1024> filter_big;
+// stubborn filters never acknowledge, but also load in 64 us
+typedef offset_filter<5, 64 * 1024, false> stubborn_a;
+typedef offset_filter<6, 64 * 1024, false> stubborn_b;
+
+#endif  // POOL_TEST_MODULES_H
@@ -0,0 +1,129 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+
+#include <memory>
+#include <systemc>
+
+#include "test_modules.h"
+
+using namespace sc_core;
+
+/**
+ * Pool with two regions, whose members are bound to signals.
+ */
+struct filter_pool : public reconf_region_pool<filter_interface> {
+  sc_vector<sc_signal<int>> in_signals, out_signals;
+
+  explicit filter_pool(const sc_module_name& nm)
+      : reconf_region_pool(nm, 2),
+        in_signals("in_signals", 2),
+        out_signals("out_signals", 2) {
+    register_module<filter_a>();
+    register_module<filter_b>();
+    register_module<filter_c>();
+    register_module<filter_big>();
+    register_module<stubborn_a>();
+    register_module<stubborn_b>();
+
+    for (size_t i = 0; i < size(); i++) {
+      (*this)[i].input.bind(in_signals[i]);
+      (*this)[i].output.bind(out_signals[i]);
+    }
+  }
+};
+
+struct top : public sc_module {
+  filter_pool lru_pool{"lru_pool"}, lfu_pool{"lfu_pool"},
+      cost_pool{"cost_pool"}, race_pool{"race_pool"};
+  sc_event start_race, race_done;
+  reconf_region<filter_interface>* race_region = nullptr;
+
+  SC_HAS_PROCESS(top);
+  explicit top(const sc_module_name& nm) : sc_module(nm) {
+    lfu_pool.set_replacement_policy(std::make_shared<lfu_replacement_policy>());
+    cost_pool.set_replacement_policy(
+        std::make_shared<cost_aware_replacement_policy>());
+    for (size_t i = 0; i < race_pool.size(); i++) {
+      race_pool[i].set_quiescence_timeout(sc_time(8, SC_US));
+    }
+
+    SC_THREAD(verify)
+    SC_THREAD(request_concurrently)
+  }
+
+  void verify() {
+    // empty regions are filled first, the least recently used module is
+    // replaced afterwards
+    auto& region_a = lru_pool.request<filter_a>();
+    wait(1, SC_US);
+    auto& region_b = lru_pool.request<filter_b>();
+    wait(1, SC_US);
+    sc_assert(&region_a != &region_b);
+    sc_assert(&lru_pool.request<filter_a>() == &region_a);
+    wait(1, SC_US);
+    sc_assert(&lru_pool.request<filter_c>() == &region_b);
+    wait(1, SC_US);
+    sc_assert(&lru_pool.request<filter_b>() == &region_a);
+    sc_assert(lru_pool.get_hit_count() == 1);
+    sc_assert(lru_pool.get_miss_count() == 4);
+    sc_assert(lru_pool.get_hit_rate() == 0.2);
+    sc_assert(lru_pool.get_average_miss_penalty() == sc_time(64, SC_US));
+
+    // the configured module is used
+    size_t c = &lru_pool.request<filter_c>() == &lru_pool[0] ? 0 : 1;
+    lru_pool.in_signals[c].write(10);
+    wait(1, SC_NS);
+    sc_assert(lru_pool.out_signals[c].read() == 13);
+
+    // the least frequently used module is replaced, although it was used
+    // last
+    lfu_pool.request<filter_a>();
+    lfu_pool.request<filter_a>();
+    lfu_pool.request<filter_a>();
+    auto& lfu_region_b = lfu_pool.request<filter_b>();
+    sc_assert(&lfu_pool.request<filter_c>() == &lfu_region_b);
+    sc_assert(lfu_pool.get_hit_count() == 2);
+
+    // the module that is cheaper to reload is replaced, although the other
+    // one was used less recently
+    auto& big_region = cost_pool.request<filter_big>();
+    cost_pool.request<filter_b>();
+    sc_assert(&cost_pool.request<filter_c>() != &big_region);
+    sc_assert(cost_pool.get_miss_penalty() ==
+              sc_time(1024, SC_US) + sc_time(128, SC_US));
+
+    // a concurrent request for a module whose region is still quiesced waits
+    // for that region instead of reconfiguring the other one as well
+    race_pool.request<stubborn_a>();
+    race_pool.request<stubborn_b>();
+    start_race.notify();
+    sc_time start = sc_time_stamp();
+    auto& c_region = race_pool.request<filter_c>();
+    sc_assert(sc_time_stamp() - start == sc_time(72, SC_US));
+    if (race_region == nullptr) wait(race_done);
+    sc_assert(race_region == &c_region);
+    sc_assert(race_pool.get_miss_count() == 3);
+    sc_assert(race_pool.get_hit_count() == 1);
+
+    NC_REPORT_TIMED_INFO(name(), "Pools replaced modules as expected.")
+  }
+
+  void request_concurrently() {
+    wait(start_race);
+    wait(1, SC_US);
+    race_region = &race_pool.request<filter_c>();
+    race_done.notify();
+  }
+};
+
+int sc_main(int argc, char** argv) {
+  top t("top");
+
+  sc_start(10, SC_MS);
+
+  return 0;
+}
@@ -0,0 +1,81 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+
+#ifndef QUIESCE_TEST_MODULES_H
+#define QUIESCE_TEST_MODULES_H
+
+#include "test_fixture.h"
+
+/**
+ * Module that processes one job after the other, each in 10 us. An imminent
+ * reconfiguration is acknowledged once the current job is finished. Loads in
+ * 16 us.
+ *
+ * @tparam Id the id of the module
+ */
+template <int Id>
+NC_MODULE(batch_module, filter_interface) {
+ public:
+  int jobs = 0;
+  bool busy = false;
+
+  SC_HAS_PROCESS(batch_module);
+  NC_CTOR(batch_module, filter_interface) { NC_THREAD(run); }
+
+  TEST_BITSTREAM_KIB(16)
+
+  void run() {
+    while (!is_reconf_imminent()) {
+      busy = true;
+      sc_core::wait(10, sc_core::SC_US);
+      busy = false;
+      output.write(++jobs);
+    }
+    acknowledge_reconf();
+  }
+
+ protected:
+  bool on_reconf_imminent() override { return !busy; }
+};
+
+/**
+ * Module that never acknowledges an imminent reconfiguration. Loads in
+ * 16 us.
+ */
+NC_MODULE(stubborn_module, filter_interface) {
+ public:
+  NC_CTOR(stubborn_module, filter_interface) {}
+
+  TEST_BITSTREAM_KIB(16)
+
+ protected:
+  bool on_reconf_imminent() override { return false; }
+};
+
+typedef batch_module<1> batch_module_a;
+typedef batch_module<2> batch_module_b;
+
+/**
+ * Module that contains a region at which a batch module is preloaded, which
+ * is quiesced before this module is unloaded. Loads in 16 us.
+ */
+NC_MODULE(batch_host, filter_interface) {
+  sc_core::sc_signal<int> inner_signal;
+
+ public:
+  reconf_region<filter_interface> inner_rz;
+
+  NC_CTOR(batch_host, filter_interface), inner_rz("inner_rz", this) {
+    inner_rz.register_module<batch_module_a>();
+    inner_rz.preload_module<batch_module_a>();
+    inner_rz.output.bind(inner_signal);
+  }
+
+  TEST_BITSTREAM_KIB(16)
+};
+
+#endif  // QUIESCE_TEST_MODULES_H
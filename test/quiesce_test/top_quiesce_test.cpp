@@ -0,0 +1,77 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+
+#include <systemc>
+
+#include "test_modules.h"
+
+using namespace sc_core;
+
+struct top : public sc_module {
+  reconf_region<filter_interface> rz{"rz"};
+  sc_signal<int> output_signal;
+
+  SC_HAS_PROCESS(top);
+  explicit top(const sc_module_name& nm) : sc_module(nm) {
+    rz.register_module<batch_module_a>();
+    rz.register_module<batch_module_b>();
+    rz.register_module<stubborn_module>();
+    rz.register_module<batch_host>();
+    rz.output.bind(output_signal);
+
+    SC_THREAD(verify)
+  }
+
+  void verify() {
+    rz.configure_module<batch_module_a>();
+    sc_assert(sc_time_stamp() == sc_time(16, SC_US));
+
+    // the load starts as soon as the second job was finished
+    wait(14, SC_US);
+    rz.configure_module<batch_module_b>();
+    sc_assert(sc_time_stamp() == sc_time(52, SC_US));
+    sc_assert(rz.get_module<batch_module_a>()->jobs == 2);
+    sc_assert(rz.get_quiescence_time() == sc_time(6, SC_US));
+
+    rz.set_quiescence_timeout(sc_time(20, SC_US));
+    wait(5, SC_US);
+    rz.configure_module<stubborn_module>();
+    sc_assert(sc_time_stamp() == sc_time(78, SC_US));
+    sc_assert(rz.get_module<batch_module_b>()->jobs == 1);
+    sc_assert(rz.get_quiescence_timeout_count() == 0);
+
+    // a module that does not acknowledge is unloaded after the timeout
+    rz.configure_module<batch_module_a>();
+    sc_assert(sc_time_stamp() == sc_time(114, SC_US));
+    sc_assert(rz.get_quiescence_timeout_count() == 1);
+    sc_assert(rz.get_quiescence_time() == sc_time(31, SC_US));
+
+    // the flag is reset when a module is configured again
+    sc_assert(!rz.get_module<batch_module_a>()->is_reconf_imminent());
+
+    // a module in a nested region finishes its job before the region that
+    // contains it is blocked
+    rz.configure_module<batch_host>();
+    sc_assert(sc_time_stamp() == sc_time(130, SC_US));
+    wait(14, SC_US);
+    rz.configure_module<stubborn_module>();
+    sc_assert(sc_time_stamp() == sc_time(166, SC_US));
+    auto& inner_rz = rz.get_module<batch_host>()->inner_rz;
+    sc_assert(inner_rz.get_module<batch_module_a>()->jobs == 2);
+    sc_assert(rz.get_quiescence_time() == sc_time(37, SC_US));
+
+    NC_REPORT_TIMED_INFO(name(), "Modules were unloaded once they were idle.")
+  }
+};
+
+int sc_main(int argc, char** argv) {
+  top t("top");
+
+  sc_start(1, SC_MS);
+
+  return 0;
+}
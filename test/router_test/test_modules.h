@@ -0,0 +1,57 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+
+#ifndef ROUTER_TEST_MODULES_H
+#define ROUTER_TEST_MODULES_H
+
+#include <tlm_utils/simple_target_socket.h>
+
+#include "accel_interface.h"
+#include "region/nc_software_model.h"
+
+/**
+ * Accelerator that remembers the address of the last transaction it received.
+ * The accelerators only differ in their type, so that several of them can be
+ * registered at a region.
+ *
+ * @tparam Id the id of the accelerator
+ */
+template <int Id>
+NC_MODULE(accel, accel_interface) {
+  tlm_utils::simple_target_socket<accel> simple_tsock{"accel_simple_tsock"};
+
+ public:
+  sc_dt::uint64 last_address = 0;
+
+  NC_CTOR(accel, accel_interface) {
+    tsock.bind(simple_tsock);
+    simple_tsock.register_b_transport(this, &accel::b_transport);
+  }
+
+  void b_transport(tlm::tlm_generic_payload & trans, sc_core::sc_time & t) {
+    last_address = trans.get_address();
+    trans.set_response_status(tlm::TLM_OK_RESPONSE);
+  }
+};
+
+/**
+ * Software model of an accelerator, which counts the transactions it served.
+ */
+struct sw_accel : public nc_software_model {
+  int requests = 0;
+
+  void b_transport(tlm::tlm_generic_payload& trans,
+                   sc_core::sc_time& t) override {
+    requests++;
+    trans.set_response_status(tlm::TLM_OK_RESPONSE);
+  }
+};
+
+typedef accel<0> accel_a;
+typedef accel<1> accel_b;
+
+#endif  // ROUTER_TEST_MODULES_H
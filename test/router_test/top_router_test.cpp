@@ -0,0 +1,127 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+
+#include <tlm_utils/simple_initiator_socket.h>
+
+#include <memory>
+#include <systemc>
+
+#include "region/nc_region_router.h"
+#include "test_modules.h"
+
+using namespace sc_core;
+
+struct top : public sc_module {
+  reconf_region<accel_interface> rz1{"rz1"}, rz2{"rz2"};
+  nc_region_router router{"router"};
+  tlm_utils::simple_initiator_socket<top> isock{"isock"};
+  int invalidations = 0;
+  std::shared_ptr<sw_accel> sw_b = std::make_shared<sw_accel>();
+  sc_event start_load;
+
+  SC_HAS_PROCESS(top);
+  explicit top(const sc_module_name& nm) : sc_module(nm) {
+    rz1.register_module<accel_a>();
+    rz1.register_module<accel_b>();
+    rz2.register_module<accel_a>();
+    rz2.register_module<accel_b>();
+    rz2.register_software_model<accel_b>(sw_b);
+
+    router.map_module<accel_a>(0x000, 0x0ff);
+    router.map_module<accel_b>(0x100, 0x1ff);
+    router.add_region(rz1, rz1.tsock);
+    router.add_region(rz2, rz2.tsock);
+
+    isock.bind(router.tsock);
+    isock.register_invalidate_direct_mem_ptr(this, &top::invalidate);
+
+    SC_THREAD(verify)
+    SC_THREAD(load_b)
+  }
+
+  void invalidate(sc_dt::uint64 start, sc_dt::uint64 end) { invalidations++; }
+
+  bool send(sc_dt::uint64 address) {
+    tlm::tlm_generic_payload trans;
+    sc_time delay = SC_ZERO_TIME;
+    trans.set_command(tlm::TLM_READ_COMMAND);
+    trans.set_address(address);
+    trans.set_response_status(tlm::TLM_INCOMPLETE_RESPONSE);
+    isock->b_transport(trans, delay);
+    return trans.is_response_ok();
+  }
+
+  void verify() {
+    // nothing is configured yet
+    sc_assert(!send(0x010));
+
+    rz1.configure_module<accel_a>();
+    rz2.configure_module<accel_b>();
+
+    // transactions reach the module with the address relative to its range
+    sc_assert(send(0x010));
+    sc_assert(rz1.get_module<accel_a>()->last_address == 0x010);
+    sc_assert(send(0x120));
+    sc_assert(rz2.get_module<accel_b>()->last_address == 0x020);
+
+    // unmapped addresses fail
+    sc_assert(!send(0x200));
+
+    // the routes follow the modules when they move to the other region, DMI
+    // pointers are invalidated for both
+    rz1.configure_module<accel_b>();
+    sc_assert(invalidations == 2);
+    rz2.configure_module<accel_a>();
+    sc_assert(invalidations == 2);
+    sc_assert(send(0x030));
+    sc_assert(rz2.get_module<accel_a>()->last_address == 0x030);
+    sc_assert(send(0x140));
+    sc_assert(rz1.get_module<accel_b>()->last_address == 0x040);
+
+    // unloaded modules cannot be reached
+    rz1.unload_module();
+    sc_assert(invalidations == 3);
+    sc_assert(!send(0x140));
+
+    // a module configured at both regions is reachable until it was unloaded
+    // from both, transactions go to the region it was configured at first
+    rz1.configure_module<accel_a>();
+    sc_assert(send(0x050));
+    sc_assert(rz2.get_module<accel_a>()->last_address == 0x050);
+    rz2.unload_module();
+    sc_assert(invalidations == 4);
+    sc_assert(send(0x060));
+    sc_assert(rz1.get_module<accel_a>()->last_address == 0x060);
+
+    // while a module is being configured, the region serves its transactions
+    // by the software model
+    start_load.notify();
+    wait(500, SC_NS);
+    sc_assert(rz2.is_reconfiguring());
+    sc_assert(send(0x170));
+    sc_assert(sw_b->requests == 1);
+    wait(rz2.reconf_end_event());
+    sc_assert(send(0x180));
+    sc_assert(rz2.get_module<accel_b>()->last_address == 0x080);
+    sc_assert(sw_b->requests == 1);
+
+    NC_REPORT_TIMED_INFO(name(), "Transactions were routed to the modules.")
+  }
+
+  void load_b() {
+    wait(start_load);
+    rz2.configure_module<accel_b>();
+  }
+};
+
+int sc_main(int argc, char** argv) {
+  top t("top");
+
+  sc_start(100, SC_US);
+
+  return 0;
+}
@@ -0,0 +1,24 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+
+#ifndef SCHEDULER_TEST_TASK_INTERFACE_H
+#define SCHEDULER_TEST_TASK_INTERFACE_H
+
+#include <systemc>
+
+#include "nc_interface.h"
+#include "region/time_slice_scheduler.h"
+
+NC_INTERFACE(task_interface) {
+  sc_core::sc_out<int> progress;
+
+  NC_LOAD_SPEED_MBPS(1024);
+
+  NC_INTERFACE_REGISTER(task_interface, progress);
+};
+
+#endif  // SCHEDULER_TEST_TASK_INTERFACE_H
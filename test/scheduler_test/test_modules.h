@@ -0,0 +1,61 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+
+#ifndef SCHEDULER_TEST_MODULES_H
+#define SCHEDULER_TEST_MODULES_H
+
+#include <cstring>
+#include <vector>
+
+#include "task_interface.h"
+#include "test_fixture.h"
+
+/**
+ * Long-running task that counts its progress every 10 us while it is
+ * configured. The progress is lost on deactivation, so it needs to be saved
+ * and restored as context. Loads in 64 us, its context is transferred in 4 us.
+ * The tasks only differ in their type, so that several of them can be
+ * registered at a region.
+ *
+ * @tparam Id the id of the task
+ */
+template <int Id>
+NC_MODULE(counting_task, task_interface) {
+ public:
+  int count = 0;
+
+  SC_HAS_PROCESS(counting_task);
+  NC_CTOR(counting_task, task_interface) { NC_THREAD(run); }
+
+  TEST_BITSTREAM_KIB(64)
+
+  size_t get_context_size_bytes() const override { return 4 * 1024; }
+
+  void run() {
+    while (true) {
+      sc_core::wait(10, sc_core::SC_US);
+      progress.write(++count);
+    }
+  }
+
+ protected:
+  void on_deactivate() override { count = 0; }
+
+  void on_save_context(std::vector<unsigned char> & context) override {
+    context.resize(sizeof(count));
+    std::memcpy(context.data(), &count, sizeof(count));
+  }
+
+  void on_restore_context(const std::vector<unsigned char>& context) override {
+    std::memcpy(&count, context.data(), sizeof(count));
+  }
+};
+
+typedef counting_task<0> task_a;
+typedef counting_task<1> task_b;
+
+#endif  // SCHEDULER_TEST_MODULES_H
@@ -0,0 +1,87 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+
+#include <systemc>
+#include <vector>
+
+#include "test_modules.h"
+
+using namespace sc_core;
+
+struct top : public sc_module {
+  reconf_region<task_interface> rz{"rz"};
+  sc_signal<int> progress_signal;
+  time_slice_scheduler<task_interface> scheduler{"scheduler", rz,
+                                                 sc_time(100, SC_US)};
+  size_t id_a, id_b;
+  // progress of A whenever it was reported as configured
+  std::vector<int> reported_counts;
+
+  SC_HAS_PROCESS(top);
+  explicit top(const sc_module_name& nm) : sc_module(nm) {
+    rz.register_module<task_a>();
+    rz.register_module<task_b>();
+    rz.progress.bind(progress_signal);
+
+    id_a = scheduler.add_task<task_a>(sc_time(250, SC_US));
+    id_b = scheduler.add_task<task_b>(sc_time(150, SC_US));
+
+    rz.add_module_listener([this](abstract_module_base* module, bool loaded) {
+      if (loaded && module == rz.get_module<task_a>().get()) {
+        reported_counts.push_back(rz.get_module<task_a>()->count);
+      }
+    });
+
+    SC_THREAD(verify)
+  }
+
+  void verify() {
+    wait(scheduler.all_finished_event());
+
+    // A runs 100 us after loading in 64 us, B after 4 us context save and
+    // 64 us load, A after 4 us save, 64 us load and 4 us restore and so on
+    const auto& a = scheduler.get_task_stats(id_a);
+    const auto& b = scheduler.get_task_stats(id_b);
+    sc_assert(a.finished && b.finished);
+    sc_assert(b.response_time() == sc_time(626, SC_US));
+    sc_assert(a.response_time() == sc_time(744, SC_US));
+    sc_assert(a.configurations == 3);
+    sc_assert(b.configurations == 2);
+    sc_assert(a.throughput() == 250.0 / 744);
+    sc_assert(scheduler.get_switch_overhead() == sc_time(344, SC_US));
+
+    // the progress of A survived its preemptions, and it was restored before
+    // A was reported as configured
+    auto a_module = rz.get_module<task_a>();
+    sc_assert(a_module->count > 20);
+    sc_assert(reported_counts.size() == 3);
+    sc_assert(reported_counts[0] == 0);
+    sc_assert(reported_counts[1] > 0);
+    sc_assert(reported_counts[2] > reported_counts[1]);
+
+    // a saved context is discarded once the module is configured without
+    // restoring it, so it is not restored after a later preemption
+    sc_assert(rz.switch_module<task_a>());
+    wait(50, SC_US);
+    sc_assert(a_module->count > 0);
+    sc_assert(rz.switch_module<task_b>());
+    sc_assert(rz.configure_module<task_a>());
+    rz.unload_module();
+    sc_assert(rz.switch_module<task_a>());
+    sc_assert(a_module->count == 0);
+
+    NC_REPORT_TIMED_INFO(name(), "Tasks were time-multiplexed.")
+  }
+};
+
+int sc_main(int argc, char** argv) {
+  top t("top");
+
+  sc_start(2, SC_MS);
+
+  return 0;
+}
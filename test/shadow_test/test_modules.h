@@ -0,0 +1,42 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+
+#ifndef SHADOW_TEST_MODULES_H
+#define SHADOW_TEST_MODULES_H
+
+#include "scale_interface.h"
+#include "test_fixture.h"
+
+/**
+ * Module that multiplies its input by a factor.
+ *
+ * @tparam Factor the factor
+ * @tparam BitstreamKiB the size of the bitstream in KiB
+ */
+template <int Factor, size_t BitstreamKiB>
+NC_MODULE(scale_module, scale_interface) {
+ public:
+  size_t activations = 0;
+
+  SC_HAS_PROCESS(scale_module);
+  NC_CTOR(scale_module, scale_interface) {
+    NC_METHOD(scale);
+    sensitive << input;
+  }
+
+  void scale() { output.write(input.read() * Factor); }
+
+  TEST_BITSTREAM_KIB(BitstreamKiB)
+
+ protected:
+  void on_activate() override { activations++; }
+};
+
+typedef scale_module<2, 16> double_module;
+typedef scale_module<3, 64> triple_module;
+
+#endif  // SHADOW_TEST_MODULES_H
@@ -0,0 +1,108 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+
+#include <systemc>
+
+#include "test_modules.h"
+
+using namespace sc_core;
+
+struct top : public sc_module {
+  shadow_reconf_region<scale_interface> rz{"rz"};
+  sc_signal<int> input_signal;
+  sc_signal<int> output_signal;
+  size_t samples_during_load = 0;
+
+  SC_HAS_PROCESS(top);
+  explicit top(const sc_module_name& nm) : sc_module(nm) {
+    rz.register_module<double_module>();
+    rz.register_module<triple_module>();
+    rz.input.bind(input_signal);
+    rz.output.bind(output_signal);
+
+    SC_THREAD(verify)
+    SC_THREAD(observe)
+  }
+
+  /**
+   * Change the input every 10 us and check that the configured module
+   * answers, also while the shadow context is loaded.
+   */
+  void observe() {
+    wait(25, SC_US);
+    for (int i = 1; i <= 13; i++) {
+      input_signal.write(i);
+      wait(1, SC_NS);
+
+      int factor =
+          rz.get_current_module() == rz.get_module<double_module>() ? 2 : 3;
+      sc_assert(output_signal.read() == i * factor);
+      // the region is not busy while the shadow context is loaded
+      if (rz.is_shadow_loading()) {
+        sc_assert(!rz.is_reconfiguring());
+        samples_during_load++;
+      }
+
+      wait(sc_time(10, SC_US) - sc_time(1, SC_NS));
+    }
+  }
+
+  void verify() {
+    rz.configure_module<double_module>();
+    sc_assert(sc_time_stamp() == sc_time(16, SC_US));
+
+    // the double module keeps serving while the triple module is load
+    sc_assert(rz.load_shadow_module<triple_module>());
+    sc_assert(sc_time_stamp() == sc_time(80, SC_US));
+    sc_assert(samples_during_load == 6);
+    sc_assert(rz.get_current_module() == rz.get_module<double_module>());
+    sc_assert(rz.get_shadow_module() == rz.get_module<triple_module>());
+    sc_assert(rz.get_module<triple_module>()->activations == 0);
+    sc_assert(rz.get_hidden_load_time() == sc_time(64, SC_US));
+
+    // swapping takes no time
+    rz.swap_modules();
+    sc_assert(sc_time_stamp() == sc_time(80, SC_US));
+    sc_assert(rz.get_current_module() == rz.get_module<triple_module>());
+    sc_assert(rz.get_shadow_module() == rz.get_module<double_module>());
+    sc_assert(rz.get_module<triple_module>()->activations == 1);
+
+    // configuring the module in the shadow context swaps it back in
+    wait(20, SC_US);
+    rz.configure_module<double_module>();
+    sc_assert(sc_time_stamp() == sc_time(100, SC_US));
+    sc_assert(rz.get_current_module() == rz.get_module<double_module>());
+    sc_assert(rz.get_module<double_module>()->activations == 2);
+    sc_assert(rz.load_shadow_module<triple_module>());
+    sc_assert(sc_time_stamp() == sc_time(100, SC_US));
+
+    sc_assert(rz.get_swap_count() == 2);
+    sc_assert(rz.get_shadow_load_time() == sc_time(64, SC_US));
+    sc_assert(rz.get_overlap_ratio() == 1);
+
+    wait(50, SC_US);
+    sc_assert(samples_during_load == 6);
+
+    // a context switch to the module in the shadow context is a swap as well
+    sc_assert(rz.switch_module<triple_module>());
+    sc_assert(sc_time_stamp() == sc_time(150, SC_US));
+    sc_assert(rz.get_current_module() == rz.get_module<triple_module>());
+    sc_assert(rz.get_shadow_module() == rz.get_module<double_module>());
+    sc_assert(rz.get_swap_count() == 3);
+    sc_assert(rz.get_shadow_load_time() == sc_time(64, SC_US));
+
+    NC_REPORT_TIMED_INFO(name(), "Modules were swapped without downtime.")
+  }
+};
+
+int sc_main(int argc, char** argv) {
+  top t("top");
+
+  sc_start(1, SC_MS);
+
+  return 0;
+}
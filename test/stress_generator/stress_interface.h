@@ -0,0 +1,106 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+
+#ifndef STRESS_INTERFACE_H
+#define STRESS_INTERFACE_H
+
+#include <systemc>
+#include <tlm>
+#include <utility>
+
+#include "nc_interface.h"
+#include "region/reconf_region.h"
+
+/**
+ * Number of sc_in members of the stress interface. Together with its output
+ * and its target socket, the interface has NC_STRESS_INPUTS + 2 members.
+ */
+#ifndef NC_STRESS_INPUTS
+#define NC_STRESS_INPUTS 2
+#endif
+
+/**
+ * A single input of the stress interface. Every input is a distinct base class
+ * of the interface, so that the number of inputs can be chosen at compile time.
+ *
+ * @tparam I the index of the input
+ */
+template <std::size_t I>
+struct stress_input {
+  sc_core::sc_in<int> in;
+};
+
+template <class Indices>
+struct stress_interface_t;
+
+/**
+ * Interface of every top-level region of the stress scenario. It mixes port and
+ * socket members, so every kind of adapter is part of the measurement. It is
+ * registered via NC_INTERFACE_MEMBERS, since its member count is not limited.
+ *
+ * @tparam Is the indices of the inputs
+ */
+template <std::size_t... Is>
+struct stress_interface_t<std::index_sequence<Is...>>
+    : public nc_interface, public stress_input<Is>... {
+  sc_core::sc_out<int> out;
+  tlm::tlm_target_socket<> t_socket;
+
+  NC_LOAD_SPEED_MBPS(380);
+
+  NC_INTERFACE_MEMBERS(stress_interface_t, &stress_input<Is>::in...,
+                       &stress_interface_t::out, &stress_interface_t::t_socket);
+
+  /**
+   * Get the input with index I.
+   */
+  template <std::size_t I>
+  sc_core::sc_in<int> &input() {
+    return static_cast<stress_input<I> &>(*this).in;
+  }
+
+  /**
+   * Get the sum of all inputs.
+   */
+  int input_sum() const {
+    return (0 + ... +
+            static_cast<const stress_input<Is> &>(*this).in.read());
+  }
+
+  /**
+   * Make the given sensitivity list sensitive to all inputs.
+   *
+   * @tparam Sensitive the type of the sensitivity list of a module
+   */
+  template <class Sensitive>
+  void make_sensitive(Sensitive &sensitive) {
+    (sensitive << ... << input<Is>());
+  }
+
+  /**
+   * Bind every input to the signal with the same index.
+   */
+  void bind_inputs(sc_core::sc_vector<sc_core::sc_signal<int>> &signals) {
+    (input<Is>().bind(signals[Is]), ...);
+  }
+};
+
+/// @brief The stress interface with NC_STRESS_INPUTS inputs.
+typedef stress_interface_t<std::make_index_sequence<NC_STRESS_INPUTS>>
+    stress_interface;
+
+/// @brief Interface of the regions nested in the stress modules.
+NC_INTERFACE(stress_inner_interface) {
+  sc_core::sc_in<int> a;
+  sc_core::sc_out<int> res;
+
+  NC_LOAD_SPEED_MBPS(380);
+
+  NC_INTERFACE_REGISTER(stress_inner_interface, a, res)
+};
+
+#endif  // STRESS_INTERFACE_H
@@ -0,0 +1,213 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+
+#ifndef STRESS_MODULES_H
+#define STRESS_MODULES_H
+
+#include <tlm_utils/simple_target_socket.h>
+
+#include <random>
+
+#include "stress_interface.h"
+
+/**
+ * Number of distinct module types that are synthesised for the stress
+ * interface. Every region registers up to this many of them.
+ */
+#ifndef NC_STRESS_MODULE_TYPES
+#define NC_STRESS_MODULE_TYPES 32
+#endif
+
+/// inner modules
+
+template <int N>
+NC_MODULE(stress_inner_module, stress_inner_interface) {
+ public:
+  SC_HAS_PROCESS(stress_inner_module);
+  NC_CTOR(stress_inner_module, stress_inner_interface) {
+    NC_METHOD(compute)
+    sensitive << a;
+  }
+
+  void compute() { res.write(a.read() + N); }
+
+  size_t get_bitstream_size_bytes() const override { return 256 * (N + 1); }
+};
+
+/**
+ * Module that contains a region of the inner interface, which it reconfigures
+ * randomly while it is active. For a depth above one, the region additionally
+ * registers another nested module, so the regions are nested as deep as the
+ * given depth.
+ */
+NC_MODULE(stress_inner_nested_module, stress_inner_interface) {
+ public:
+  SC_HAS_PROCESS(stress_inner_nested_module);
+
+  /**
+   * Create the module with the given number of nested region levels.
+   *
+   * @param depth the number of region levels within this module, at least 1
+   * @param nm the name of the module
+   */
+  explicit stress_inner_nested_module(
+      size_t depth,
+      const sc_core::sc_module_name &nm =
+          sc_core::sc_gen_unique_name("stress_inner_nested_module"))
+      : stress_inner_interface::module_base(nm),
+        m_rr("inner_rr", this),
+        m_depth(depth) {
+    register_inner_modules(m_rr, depth);
+
+    // important to bind this way around due to hierarchical binding
+    m_rr.a.bind(a);
+    m_rr.res.bind(res);
+
+    NC_THREAD(reconf)
+  }
+
+  /**
+   * Register the inner modules at the given region and preload one of them.
+   * If the depth is larger than one, a nested module with one level less is
+   * registered as well.
+   */
+  static void register_inner_modules(reconf_region<stress_inner_interface> &rr,
+                                     size_t depth) {
+    rr.register_module<stress_inner_module<0>>();
+    rr.register_module<stress_inner_module<1>>();
+    if (depth > 1) {
+      rr.register_module<stress_inner_nested_module>(depth - 1);
+    }
+    rr.preload_module<stress_inner_module<0>>();
+  }
+
+  /**
+   * Randomly reconfigure the given region with one of the modules registered
+   * by register_inner_modules. Must be called from a thread process.
+   */
+  [[noreturn]] static void reconf_randomly(
+      reconf_region<stress_inner_interface> &rr, size_t depth,
+      std::mt19937 &rng) {
+    std::uniform_int_distribution<int> gap(200, 2000);
+    std::uniform_int_distribution<int> pick(0, depth > 1 ? 2 : 1);
+
+    while (true) {
+      sc_core::wait(gap(rng), sc_core::SC_NS);
+      switch (pick(rng)) {
+        case 0:
+          rr.configure_module<stress_inner_module<0>>();
+          break;
+        case 1:
+          rr.configure_module<stress_inner_module<1>>();
+          break;
+        default:
+          rr.configure_module<stress_inner_nested_module>();
+          break;
+      }
+    }
+  }
+
+  [[noreturn]] void reconf() { reconf_randomly(m_rr, m_depth, m_rng); }
+
+  size_t get_bitstream_size_bytes() const override { return 1024; }
+
+ private:
+  reconf_region<stress_inner_interface> m_rr;
+  size_t m_depth;
+  std::mt19937 m_rng{42};
+};
+
+/// top-level modules
+
+/**
+ * Synthesised module type. The template argument only serves to create
+ * distinct types and to vary the bitstream size and the behavior slightly.
+ *
+ * @tparam N the index of the synthesised module type
+ */
+template <int N>
+NC_MODULE(stress_module, stress_interface) {
+  tlm_utils::simple_target_socket<stress_module> simple_tsock{
+      "module_simple_tsock"};
+
+ public:
+  SC_HAS_PROCESS(stress_module);
+  NC_CTOR(stress_module, stress_interface) {
+    t_socket.bind(simple_tsock);
+    simple_tsock.register_b_transport(this, &stress_module::b_transport);
+
+    NC_METHOD(compute)
+    make_sensitive(sensitive);
+  }
+
+  void compute() { out.write(input_sum() * (N + 1)); }
+
+  void b_transport(tlm::tlm_base_protocol_types::tlm_payload_type & trans,
+                   sc_core::sc_time & t) {
+    t += sc_core::sc_time(N + 1, sc_core::SC_NS);
+    trans.set_response_status(tlm::TLM_OK_RESPONSE);
+  }
+
+  size_t get_bitstream_size_bytes() const override {
+    return 1024 * (1 + N % 8);
+  }
+};
+
+/**
+ * Module that contains a nested region of the inner interface, which it
+ * reconfigures randomly while it is active. The region registers two inner
+ * modules and, for a depth above one, a stress_inner_nested_module.
+ */
+NC_MODULE(stress_nested_module, stress_interface) {
+  tlm_utils::simple_target_socket<stress_nested_module> simple_tsock{
+      "module_simple_tsock"};
+
+ public:
+  SC_HAS_PROCESS(stress_nested_module);
+
+  /**
+   * Create the module with the given number of nested region levels.
+   *
+   * @param depth the number of region levels within this module, at least 1
+   * @param nm the name of the module
+   */
+  explicit stress_nested_module(
+      size_t depth, const sc_core::sc_module_name &nm =
+                        sc_core::sc_gen_unique_name("stress_nested_module"))
+      : stress_interface::module_base(nm),
+        m_rr("inner_rr", this),
+        m_depth(depth) {
+    t_socket.bind(simple_tsock);
+    simple_tsock.register_b_transport(this,
+                                      &stress_nested_module::b_transport);
+
+    stress_inner_nested_module::register_inner_modules(m_rr, depth);
+
+    // important to bind this way around due to hierarchical binding
+    m_rr.a.bind(input<0>());
+    m_rr.res.bind(out);
+
+    NC_THREAD(reconf)
+  }
+
+  [[noreturn]] void reconf() {
+    stress_inner_nested_module::reconf_randomly(m_rr, m_depth, m_rng);
+  }
+
+  void b_transport(tlm::tlm_base_protocol_types::tlm_payload_type & trans,
+                   sc_core::sc_time & t) {
+    t += sc_core::sc_time(1, sc_core::SC_NS);
+    trans.set_response_status(tlm::TLM_OK_RESPONSE);
+  }
+
+ private:
+  reconf_region<stress_inner_interface> m_rr;
+  size_t m_depth;
+  std::mt19937 m_rng{42};
+};
+
+#endif  // STRESS_MODULES_H
@@ -0,0 +1,335 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+
+/**
+ * Parametrised stress scenario for scalability measurements.
+ *
+ * The generator instantiates a configurable number of reconfiguration regions,
+ * registers up to NC_STRESS_MODULE_TYPES synthesised module types at each of
+ * them (and optionally a module with nested regions) and drives every region
+ * with a random reconfiguration schedule and some TLM traffic. Afterwards, it
+ * reports the elaboration time, the number of sc_objects, the peak resident set
+ * size and the simulation speed. The number of inputs of the interface is set
+ * at compile time by NC_STRESS_INPUTS.
+ *
+ * Usage:
+ *   stress_generator [--regions=N] [--modules=N] [--nested-every=N]
+ *                    [--depth=N] [--sim-us=N] [--min-gap-ns=N]
+ *                    [--max-gap-ns=N] [--transactions=N] [--seed=N]
+ */
+
+#include <sysc/kernel/sc_spawn.h>
+
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
+#include "bw_if_dummy.h"
+#include "stress_modules.h"
+
+using namespace sc_core;
+
+namespace stress {
+
+typedef reconf_region<stress_interface> region_t;
+typedef std::chrono::steady_clock wall_clock;
+
+/**
+ * Parameters of the stress scenario.
+ */
+struct options {
+  /// @brief number of top-level reconfiguration regions
+  size_t regions = 1000;
+  /// @brief number of synthesised module types registered per region
+  size_t modules = 24;
+  /// @brief every n-th region additionally registers the nested module (0 =>
+  /// none)
+  size_t nested_every = 10;
+  /// @brief number of region levels within the nested module
+  size_t depth = 1;
+  /// @brief simulated time in microseconds
+  double sim_us = 100;
+  /// @brief lower bound of the random gap between two reconfigurations
+  int min_gap_ns = 500;
+  /// @brief upper bound of the random gap between two reconfigurations
+  int max_gap_ns = 5000;
+  /// @brief number of transactions issued after every reconfiguration
+  size_t transactions = 4;
+  /// @brief seed of the random schedules
+  unsigned seed = 1;
+
+  /**
+   * Parse the options from the command line arguments. Unknown arguments
+   * terminate the program.
+   */
+  void parse(int argc, char **argv) {
+    for (int i = 1; i < argc; i++) {
+      std::string arg(argv[i]);
+      auto eq = arg.find('=');
+      std::string key = arg.substr(0, eq);
+      const char *val = eq == std::string::npos ? "" : argv[i] + eq + 1;
+
+      if (key == "--regions") {
+        regions = std::strtoul(val, nullptr, 10);
+      } else if (key == "--modules") {
+        modules = std::strtoul(val, nullptr, 10);
+      } else if (key == "--nested-every") {
+        nested_every = std::strtoul(val, nullptr, 10);
+      } else if (key == "--depth") {
+        depth = std::strtoul(val, nullptr, 10);
+      } else if (key == "--sim-us") {
+        sim_us = std::strtod(val, nullptr);
+      } else if (key == "--min-gap-ns") {
+        min_gap_ns = std::atoi(val);
+      } else if (key == "--max-gap-ns") {
+        max_gap_ns = std::atoi(val);
+      } else if (key == "--transactions") {
+        transactions = std::strtoul(val, nullptr, 10);
+      } else if (key == "--seed") {
+        seed = std::strtoul(val, nullptr, 10);
+      } else {
+        std::cerr << "Unknown argument: " << arg << std::endl;
+        std::exit(1);
+      }
+    }
+
+    if (modules == 0 || modules > NC_STRESS_MODULE_TYPES) {
+      std::cerr << "--modules must be in [1, " << NC_STRESS_MODULE_TYPES
+                << "]" << std::endl;
+      std::exit(1);
+    }
+    if (depth == 0) {
+      std::cerr << "--depth must be at least 1" << std::endl;
+      std::exit(1);
+    }
+    if (min_gap_ns <= 0 || max_gap_ns < min_gap_ns) {
+      std::cerr << "Invalid reconfiguration gap." << std::endl;
+      std::exit(1);
+    }
+  }
+};
+
+/// @brief Function type used to perform an action for one module type on a
+/// region.
+typedef void (*region_action)(region_t &);
+
+/**
+ * Create a table of functions that register the synthesised module types.
+ */
+template <std::size_t... Is>
+auto make_registrars(std::index_sequence<Is...>) {
+  return std::array<region_action, sizeof...(Is)>{
+      [](region_t &rr) { rr.register_module<stress_module<Is>>(); }...};
+}
+
+/**
+ * Create a table of functions that configure the synthesised module types.
+ */
+template <std::size_t... Is>
+auto make_configurators(std::index_sequence<Is...>) {
+  return std::array<region_action, sizeof...(Is)>{
+      [](region_t &rr) { rr.configure_module<stress_module<Is>>(); }...};
+}
+
+/**
+ * Count the given objects and all of their descendants.
+ */
+size_t count_objects(const std::vector<sc_object *> &objects) {
+  size_t count = objects.size();
+  for (auto *object : objects) {
+    count += count_objects(object->get_child_objects());
+  }
+  return count;
+}
+
+struct top : public sc_module {
+  const options &opts;
+
+  sc_vector<region_t> regions;
+  sc_vector<tlm::tlm_initiator_socket<>> isocks;
+  sc_vector<sc_signal<int>> out_signals;
+  sc_vector<sc_signal<int>> in_signals;
+  bw_if_dummy bw_dummy;
+
+  std::vector<std::vector<region_action>> configurators;
+  size_t reconfigurations = 0;
+  size_t objects = 0;
+  wall_clock::time_point elaboration_done;
+
+  SC_HAS_PROCESS(top);
+
+  top(const sc_module_name &nm, const options &p_opts)
+      : sc_module(nm),
+        opts(p_opts),
+        regions("rr"),
+        isocks("isock"),
+        out_signals("out_signal", p_opts.regions),
+        in_signals("in_signal", NC_STRESS_INPUTS) {
+    static const auto registrars = make_registrars(
+        std::make_index_sequence<NC_STRESS_MODULE_TYPES>());
+    static const auto all_configurators = make_configurators(
+        std::make_index_sequence<NC_STRESS_MODULE_TYPES>());
+
+    regions.init(opts.regions, [](const char *name, size_t) {
+      return new region_t(name);
+    });
+    isocks.init(opts.regions);
+    configurators.resize(opts.regions);
+
+    for (size_t i = 0; i < opts.regions; i++) {
+      auto &rr = regions[i];
+
+      for (size_t m = 0; m < opts.modules; m++) {
+        registrars[m](rr);
+        configurators[i].push_back(all_configurators[m]);
+      }
+
+      if (opts.nested_every != 0 && i % opts.nested_every == 0) {
+        rr.register_module<stress_nested_module>(opts.depth);
+        configurators[i].push_back(
+            [](region_t &r) { r.configure_module<stress_nested_module>(); });
+      }
+
+      rr.bind_inputs(in_signals);
+      rr.out.bind(out_signals[i]);
+
+      isocks[i].bind(rr.t_socket);
+      isocks[i].bind(bw_dummy);
+
+      sc_spawn([this, i] { control(i); }, sc_gen_unique_name("control"));
+    }
+
+    SC_THREAD(stimulus)
+  }
+
+  void end_of_elaboration() override {
+    elaboration_done = wall_clock::now();
+    // adapters spawn their processes before the end of elaboration, so all
+    // objects exist by now
+    objects = count_objects(sc_get_top_level_objects());
+  }
+
+  /**
+   * Randomly reconfigure the region with the given index and issue some
+   * transactions to the newly configured module.
+   */
+  [[noreturn]] void control(size_t i) {
+    std::mt19937 rng(opts.seed + i);
+    std::uniform_int_distribution<size_t> pick(0, configurators[i].size() - 1);
+    std::uniform_int_distribution<int> gap(opts.min_gap_ns, opts.max_gap_ns);
+
+    tlm::tlm_generic_payload p;
+    unsigned char data = 0;
+    p.set_command(tlm::TLM_WRITE_COMMAND);
+    p.set_data_ptr(&data);
+    p.set_data_length(1);
+
+    while (true) {
+      wait(gap(rng), SC_NS);
+
+      configurators[i][pick(rng)](regions[i]);
+      ++reconfigurations;
+
+      for (size_t t = 0; t < opts.transactions; t++) {
+        sc_time delay = SC_ZERO_TIME;
+        p.set_address(t);
+        isocks[i]->b_transport(p, delay);
+        wait(delay);
+      }
+    }
+  }
+
+  /**
+   * Toggle the inputs shared by all regions.
+   */
+  [[noreturn]] void stimulus() {
+    int val = 0;
+    while (true) {
+      wait(10, SC_NS);
+      ++val;
+      for (size_t s = 0; s < in_signals.size(); s++) {
+        in_signals[s].write(s % 2 == 0 ? val : -val);
+      }
+    }
+  }
+};
+
+/**
+ * Get the peak resident set size of this process in KiB, or 0 if it cannot be
+ * determined on this platform.
+ */
+long peak_rss_kib() {
+#ifndef _WIN32
+  struct rusage usage {};
+  getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+  return usage.ru_maxrss / 1024;
+#else
+  return usage.ru_maxrss;
+#endif
+#else
+  return 0;
+#endif
+}
+
+}  // namespace stress
+
+int sc_main(int argc, char **argv) {
+  using namespace stress;
+
+  options opts;
+  opts.parse(argc, argv);
+
+  auto construction_start = wall_clock::now();
+  top t("stress_top", opts);
+
+  // sc_start runs the elaboration callbacks, so the end of elaboration is
+  // stamped by the top module
+  auto delta_start = sc_delta_count();
+  sc_start(opts.sim_us, SC_US);
+  auto sim_end = wall_clock::now();
+
+  std::chrono::duration<double> elaboration =
+      t.elaboration_done - construction_start;
+  std::chrono::duration<double> simulation = sim_end - t.elaboration_done;
+  double simulated_s = sc_time_stamp().to_seconds();
+  double wall_s = simulation.count();
+
+  std::cout << "regions=" << opts.regions << "\n"
+            << "module_types_per_region=" << opts.modules << "\n"
+            << "inputs=" << NC_STRESS_INPUTS << "\n"
+            << "nested_every=" << opts.nested_every << "\n"
+            << "depth=" << opts.depth << "\n"
+            << "elaboration_wall_s=" << elaboration.count() << "\n"
+            << "simulation_wall_s=" << wall_s << "\n"
+            << "total_wall_s="
+            << std::chrono::duration<double>(sim_end - construction_start)
+                   .count()
+            << "\n"
+            << "peak_rss_kib=" << peak_rss_kib() << "\n"
+            << "sc_objects=" << t.objects << "\n"
+            << "simulated_s=" << simulated_s << "\n"
+            << "sim_time_per_wall_s=" << (wall_s > 0 ? simulated_s / wall_s : 0)
+            << "\n"
+            << "delta_cycles_per_wall_s="
+            << (wall_s > 0 ? (sc_delta_count() - delta_start) / wall_s : 0)
+            << "\n"
+            << "reconfigurations=" << t.reconfigurations << "\n"
+            << "reconfigurations_per_wall_s="
+            << (wall_s > 0 ? t.reconfigurations / wall_s : 0) << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,25 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+
+#ifndef TASK_GRAPH_TEST_STREAM_INTERFACE_H
+#define TASK_GRAPH_TEST_STREAM_INTERFACE_H
+
+#include <systemc>
+#include <tlm>
+
+#include "nc_interface.h"
+#include "region/task_graph_scheduler.h"
+
+NC_INTERFACE(stream_interface) {
+  tlm::tlm_target_socket<> tsock;
+
+  NC_LOAD_SPEED_MBPS(1024);
+
+  NC_INTERFACE_REGISTER(stream_interface, tsock);
+};
+
+#endif  // TASK_GRAPH_TEST_STREAM_INTERFACE_H
@@ -0,0 +1,47 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+
+#ifndef TASK_GRAPH_TEST_MODULES_H
+#define TASK_GRAPH_TEST_MODULES_H
+
+#include <tlm_utils/simple_target_socket.h>
+
+#include "stream_interface.h"
+#include "test_fixture.h"
+
+/**
+ * Module that receives the input data of a task without delay and counts the
+ * received bytes. Loads in 64 us. The modules only differ in their type, so
+ * that several of them can be registered at a region.
+ *
+ * @tparam Id the id of the module
+ */
+template <int Id>
+NC_MODULE(stage_module, stream_interface) {
+  tlm_utils::simple_target_socket<stage_module> simple_tsock{
+      "stage_simple_tsock"};
+
+ public:
+  size_t received = 0;
+
+  NC_CTOR(stage_module, stream_interface) {
+    tsock.bind(simple_tsock);
+    simple_tsock.register_b_transport(this, &stage_module::b_transport);
+  }
+
+  TEST_BITSTREAM_KIB(64)
+
+  void b_transport(tlm::tlm_generic_payload & trans, sc_core::sc_time & t) {
+    received += trans.get_data_length();
+    trans.set_response_status(tlm::TLM_OK_RESPONSE);
+  }
+};
+
+typedef stage_module<0> stage_a;
+typedef stage_module<1> stage_b;
+
+#endif  // TASK_GRAPH_TEST_MODULES_H
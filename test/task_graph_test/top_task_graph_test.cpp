@@ -0,0 +1,118 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+
+#include <tlm_utils/simple_initiator_socket.h>
+
+#include <systemc>
+#include <vector>
+
+#include "test_modules.h"
+
+using namespace sc_core;
+
+typedef task_graph_scheduler<stream_interface> scheduler_type;
+
+/**
+ * Two reconfiguration regions that execute the same task graph with the given
+ * policy. A task sends its input data to the region with one TLM transaction
+ * and then computes.
+ */
+struct platform : public sc_module {
+  reconf_region<stream_interface> rz0{"rz0"}, rz1{"rz1"};
+  tlm_utils::simple_initiator_socket<platform> isock0{"isock0"},
+      isock1{"isock1"};
+  scheduler_type scheduler;
+
+  platform(const sc_module_name& nm, scheduler_type::policy p)
+      : sc_module(nm), scheduler("scheduler", p) {
+    rz0.register_module<stage_a>();
+    rz0.register_module<stage_b>();
+    rz1.register_module<stage_a>();
+    rz1.register_module<stage_b>();
+    isock0.bind(rz0.tsock);
+    isock1.bind(rz1.tsock);
+
+    scheduler.add_region(rz0);
+    scheduler.add_region(rz1);
+    scheduler.set_executor([this](reconf_region<stream_interface>& rr,
+                                  sc_time compute_time, size_t data_size) {
+      send(&rr == &rz0 ? isock0 : isock1, data_size);
+      wait(compute_time);
+    });
+
+    // two chains of stage_a and stage_b tasks
+    size_t a0 = scheduler.add_task<stage_a>(sc_time(100, SC_US), 1024);
+    size_t b0 = scheduler.add_task<stage_b>(sc_time(50, SC_US), 1024);
+    size_t a1 = scheduler.add_task<stage_a>(sc_time(100, SC_US), 1024);
+    size_t b1 = scheduler.add_task<stage_b>(sc_time(100, SC_US), 1024);
+    scheduler.add_dependency(a0, a1);
+    scheduler.add_dependency(b0, b1);
+  }
+
+  void send(tlm_utils::simple_initiator_socket<platform>& isock,
+            size_t data_size) {
+    std::vector<unsigned char> data(data_size);
+    tlm::tlm_generic_payload trans;
+    sc_time delay = SC_ZERO_TIME;
+    trans.set_command(tlm::TLM_WRITE_COMMAND);
+    trans.set_data_ptr(data.data());
+    trans.set_data_length(data_size);
+
+    isock->b_transport(trans, delay);
+    sc_assert(trans.is_response_ok());
+  }
+};
+
+struct top : public sc_module {
+  platform heft{"heft", scheduler_type::policy::heft};
+  platform greedy{"greedy", scheduler_type::policy::greedy};
+
+  SC_HAS_PROCESS(top);
+  explicit top(const sc_module_name& nm) : sc_module(nm) {
+    SC_THREAD(verify)
+  }
+
+  void verify() {
+    wait(heft.scheduler.all_finished_event() &
+         greedy.scheduler.all_finished_event());
+
+    // HEFT keeps every chain at one region, so each module is load once
+    const scheduler_type& h = heft.scheduler;
+    sc_assert(h.get_makespan() == sc_time(264, SC_US));
+    sc_assert(h.get_reconfiguration_count() == 2);
+    sc_assert(h.get_reconfiguration_overhead() == sc_time(128, SC_US));
+    sc_assert(h.get_task_stats(2).region == 0);
+    sc_assert(!h.get_task_stats(2).reconfigured);
+    sc_assert(h.get_task_stats(3).region == 1);
+    sc_assert(h.get_task_stats(3).finish_time == sc_time(214, SC_US));
+    sc_assert(h.get_utilization(0) == 200.0 / 264);
+    sc_assert(h.get_utilization(1) == 150.0 / 264);
+    sc_assert(heft.rz0.get_module<stage_a>()->received == 2048);
+    sc_assert(heft.rz1.get_module<stage_b>()->received == 2048);
+
+    // greedy takes the region that is free first and swaps the chains
+    const scheduler_type& g = greedy.scheduler;
+    sc_assert(g.get_makespan() == sc_time(328, SC_US));
+    sc_assert(g.get_reconfiguration_count() == 4);
+    sc_assert(g.get_reconfiguration_overhead() == sc_time(256, SC_US));
+    sc_assert(g.get_task_stats(2).region == 1);
+    sc_assert(g.get_task_stats(2).start_time == sc_time(178, SC_US));
+    sc_assert(g.get_task_stats(3).region == 0);
+    sc_assert(greedy.rz0.get_module<stage_b>()->received == 1024);
+    sc_assert(greedy.rz1.get_module<stage_a>()->received == 1024);
+
+    NC_REPORT_TIMED_INFO(name(), "Task graphs were scheduled.")
+  }
+};
+
+int sc_main(int argc, char** argv) {
+  top t("top");
+
+  sc_start(1, SC_MS);
+
+  return 0;
+}
@@ -0,0 +1,35 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+
+#ifndef TEST_FIXTURE_H
+#define TEST_FIXTURE_H
+
+#include <systemc>
+
+#include "nc_interface.h"
+#include "region/reconf_region.h"
+
+/// @brief Declare the bitstream size of a test module in KiB. At the load
+/// speed of the test interfaces, every KiB is written in 1 us.
+#define TEST_BITSTREAM_KIB(kib)                      \
+  size_t get_bitstream_size_bytes() const override { \
+    return (kib) * 1024;                             \
+  }
+
+/**
+ * Interface with a single output, which the tests use when they only look at
+ * the timing of reconfigurations.
+ */
+NC_INTERFACE(filter_interface) {
+  sc_core::sc_out<int> output;
+
+  NC_LOAD_SPEED_MBPS(1024);
+
+  NC_INTERFACE_REGISTER(filter_interface, output);
+};
+
+#endif  // TEST_FIXTURE_H
@@ -0,0 +1,46 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+
+#ifndef VARIANT_TEST_MODULES_H
+#define VARIANT_TEST_MODULES_H
+
+#include "scale_interface.h"
+#include "test_fixture.h"
+
+/**
+ * Small but slow implementation of the scale function, loads in 64 us.
+ */
+NC_MODULE(scale_small, scale_interface) {
+ public:
+  SC_HAS_PROCESS(scale_small);
+  NC_CTOR(scale_small, scale_interface) {
+    NC_METHOD(scale);
+    sensitive << input;
+  }
+
+  TEST_BITSTREAM_KIB(64)
+
+  void scale() { output.write(2 * input.read()); }
+};
+
+/**
+ * Large but fast implementation of the scale function, loads in 1024 us.
+ */
+NC_MODULE(scale_fast, scale_interface) {
+ public:
+  SC_HAS_PROCESS(scale_fast);
+  NC_CTOR(scale_fast, scale_interface) {
+    NC_METHOD(scale);
+    sensitive << input;
+  }
+
+  TEST_BITSTREAM_KIB(1024)
+
+  void scale() { output.write(2 * input.read()); }
+};
+
+#endif  // VARIANT_TEST_MODULES_H
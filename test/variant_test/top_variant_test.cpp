@@ -0,0 +1,92 @@
+/**
+ * Copyright 2024 The NC-Library Authors. All rights reserved.
+ *
+ * Licensed under Apache License Version 2.0.
+ *
+ */
+
+#include <cmath>
+#include <memory>
+#include <systemc>
+
+#include "test_modules.h"
+
+using namespace sc_core;
+
+/**
+ * Always selects the first variant of a function.
+ */
+struct first_variant_policy : public variant_selection_policy {
+  size_t select(const std::vector<variant_candidate>& candidates,
+                double work) override {
+    return 0;
+  }
+};
+
+struct top : public sc_module {
+  reconf_region<scale_interface> rz{"rz"};
+  sc_signal<int> in_signal, out_signal;
+
+  SC_HAS_PROCESS(top);
+  explicit top(const sc_module_name& nm) : sc_module(nm) {
+    // throughput in work units per us
+    rz.register_variant<scale_small>("scale", 1);
+    rz.register_variant<scale_fast>("scale", 16);
+
+    rz.input.bind(in_signal);
+    rz.output.bind(out_signal);
+
+    SC_THREAD(verify)
+  }
+
+  void verify() {
+    auto small = rz.get_module<scale_small>();
+    auto fast = rz.get_module<scale_fast>();
+
+    // little work: loading the small variant is faster
+    sc_time start = sc_time_stamp();
+    sc_assert(rz.configure_function("scale", 10) == small);
+    sc_assert(sc_time_stamp() - start == sc_time(64, SC_US));
+
+    // much work: the fast variant pays off despite its load time
+    start = sc_time_stamp();
+    sc_assert(rz.configure_function("scale", 100000) == fast);
+    sc_assert(sc_time_stamp() - start == sc_time(1024, SC_US));
+    // the small variant had not finished its 10 us of work yet
+    sc_assert(rz.get_variant_preemption_count() == 1);
+    sc_assert(rz.get_preempted_work() == 10);
+
+    // the configured variant needs no reconfiguration at all, once it is idle
+    wait(6250, SC_US);
+    start = sc_time_stamp();
+    sc_assert(rz.configure_function("scale", 10) == fast);
+    sc_assert(sc_time_stamp() == start);
+
+    in_signal.write(21);
+    wait(1, SC_NS);
+    sc_assert(out_signal.read() == 42);
+
+    // while the fast variant is busy with much work, loading the small variant
+    // for little work is faster than waiting
+    sc_assert(rz.configure_function("scale", 100000) == fast);
+    start = sc_time_stamp();
+    sc_assert(rz.configure_function("scale", 10) == small);
+    sc_assert(sc_time_stamp() - start == sc_time(64, SC_US));
+    // both requests to the fast variant were dropped, the first one partly
+    sc_assert(rz.get_variant_preemption_count() == 2);
+    sc_assert(std::abs(rz.get_preempted_work() - 100019.984) < 1e-6);
+
+    rz.set_variant_policy(std::make_shared<first_variant_policy>());
+    sc_assert(rz.configure_function("scale", 100000) == small);
+
+    NC_REPORT_TIMED_INFO(name(), "Variants were selected as expected.")
+  }
+};
+
+int sc_main(int argc, char** argv) {
+  top t("top");
+
+  sc_start(10, SC_MS);
+
+  return 0;
+}